@@ -17,6 +17,25 @@
 #include <string.h>
 #include "Structs.h"
 #include "FuncoesAntena.h"
+#include "FuncoesFicheiro.h"
+#include "FuncoesThreads.h"
+#include "FuncoesSimd.h"
+
+#define TAMANHO_MINIMO_PEDACO (1 << 16)
+
+/**
+ * @brief Parte do ficheiro lida por uma thread, sempre alinhada ao incio de uma linha.
+ */
+typedef struct PedacoFicheiro {
+    const char* inicio;  /**< Primeiro caracter do pedao */
+    const char* fim;     /**< Caracter seguinte ao ltimo do pedao */
+    Antena* primeira;    /**< Primeira antena lida no pedao */
+    Antena* ultima;      /**< ltima antena lida no pedao */
+    int numQuebras;      /**< Nmero de quebras de linha do pedao */
+    int maxColunas;      /**< Comprimento da maior linha do pedao */
+    int linhaBase;       /**< Nmero de linhas antes do pedao */
+    int erro;            /**< Diferente de 0 se faltou memria */
+} PedacoFicheiro;
 
  /**
   * @brief L um ficheiro e cria uma lista de antenas a partir das suas coordenadas.
@@ -32,44 +51,186 @@
   * @return A lista de antenas atualizada.
   *
   * @details
-  * A funo l o ficheiro linha por linha e processa cada caracter. Para cada antena (caracter que no seja '.'),
-  * a funo chama a funo `InserirAntenaFim` para adicionar a antena  lista. As coordenadas X e Y so
-  * calculadas com base na posio do caracter no ficheiro. O nmero mximo de colunas  calculado durante
-  * a leitura do ficheiro, e o nmero de linhas  determinado pela quantidade de quebras de linha encontradas.
+  * O ficheiro  lido de uma s vez para memria e percorrido com `ProximaCelulaOcupada`, que salta
+  * as clulas vazias ('.') comparando vrios caracteres de cada vez. Para cada antena encontrada 
+  * criado um n no fim da lista. As coordenadas X e Y so calculadas com base na posio do caracter
+  * no ficheiro. O nmero mximo de colunas  o comprimento da maior linha, e o nmero de linhas 
+  * determinado pela quantidade de quebras de linha encontradas.  o caso de uma s thread de
+  * `LerFicheiroParalelo`.
   */
 Antena* LerFicheiro(char* nomeFicheiro, Antena* lista, int* numLinhas, int* numColunas)
 {
-    FILE* ficheiro = fopen(nomeFicheiro, "r");  // Abre o ficheiro para leitura
-    if (ficheiro == NULL) return lista;  // Se no conseguir abrir, devolve a lista como est
+    return LerFicheiroParalelo(nomeFicheiro, lista, numLinhas, numColunas, 1); // Uma nica thread
+}
+
+/**
+ * @brief L o contedo completo de um ficheiro para memria.
+ *
+ * @param nomeFicheiro O nome do ficheiro a ler.
+ * @param tamanho Ponteiro para a varivel que receber o nmero de bytes lidos.
+ * @return Ponteiro para o contedo (a libertar com free) ou NULL em caso de erro.
+ */
+static char* LerConteudoFicheiro(char* nomeFicheiro, size_t* tamanho)
+{
+    FILE* ficheiro = fopen(nomeFicheiro, "rb");
+    if (ficheiro == NULL) return NULL;
 
-    char c;
-    int x = 1, y = 1;  // Inicializa as coordenadas com 1
-    int maxColunas = 0; // Para contar as colunas mximas por linha
+    size_t capacidade = 1 << 16, lidos = 0;
+    char* dados = (char*)malloc(capacidade);
+    while (dados != NULL) {
+        lidos += fread(dados + lidos, 1, capacidade - lidos, ficheiro);
+        if (lidos < capacidade) break; // Chegou ao fim do ficheiro
 
-    // L o ficheiro linha por linha
-    while ((c = fgetc(ficheiro)) != EOF) {
-        if (c == '\n') {  // Nova linha, avanar para a prxima linha (aumenta a coordenada y)
-            y++;
-            x = 1;  // Reseta a coordenada x ao passar para a prxima linha
+        char* novo = (char*)realloc(dados, capacidade * 2);
+        if (novo == NULL) {
+            free(dados);
+            dados = NULL;
+            break;
         }
-        else {
-            if (c != '.') {  // Ignorar clulas vazias
-                // Adicionar antena  lista existente
-                lista = InserirAntenaFim(lista, c, x, y);
-            }
-            x++;  // Avana a coordenada x
+        dados = novo;
+        capacidade *= 2;
+    }
+    fclose(ficheiro);
+
+    *tamanho = lidos;
+    return dados;
+}
+
+/**
+ * @brief L as antenas de um pedao do ficheiro (executada por cada thread).
+ *
+ * As antenas ficam numa lista prpria da thread, com a coordenada Y relativa ao incio
+ * do pedao, porque o nmero de linhas dos pedaos anteriores ainda no  conhecido.
+ */
+static void LerPedaco(void* dados, int indiceThread, int numThreads)
+{
+    (void)numThreads;
+    PedacoFicheiro* p = &((PedacoFicheiro*)dados)[indiceThread];
+    const char* inicioLinha = p->inicio;
+    const char* c = p->inicio;
+    int y = 0;
+
+    while (1) {
+        c = ProximaCelulaOcupada(c, p->fim); // Salta as clulas vazias
+
+        // Fim de linha: "\n", "\r\n", ou um "\r" no fim do ficheiro (como em Fase 2)
+        int fimLinha = c == p->fim || *c == '\n' || (*c == '\r' && (c + 1 == p->fim || c[1] == '\n'));
+        if (fimLinha) {
+            int comprimento = (int)(c - inicioLinha);
+            if (comprimento > p->maxColunas) p->maxColunas = comprimento;
+            if (c < p->fim && *c == '\r') c++;
+            if (c == p->fim) break; // Um "\r" final termina a ltima linha, tal como o fim do ficheiro
+
+            c++;
+            p->numQuebras++;
+            y++;
+            inicioLinha = c;
+            continue;
         }
 
-        // Atualizar o nmero de colunas, se for a linha com mais colunas
-        if (x > maxColunas) {
-            maxColunas = x - 1;  // x foi incrementado aps o uso, ento subtramos 1
+        // Antena: acrescenta  lista da thread
+        Antena* nova = CriarAntena(*c, (int)(c - inicioLinha) + 1, y);
+        if (nova == NULL) {
+            p->erro = 1;
+            return;
         }
+        if (p->ultima == NULL) p->primeira = nova;
+        else p->ultima->prox = nova;
+        p->ultima = nova;
+        c++;
     }
+}
 
-    // Definir as variveis numLinhas e numColunas
-    *numLinhas = y;     // O nmero de linhas ser a ltima linha lida
-    *numColunas = maxColunas; // O nmero mximo de colunas encontrado
+/**
+ * @brief Converte a coordenada Y das antenas de um pedao de relativa para absoluta.
+ */
+static void AjustarLinhasPedaco(void* dados, int indiceThread, int numThreads)
+{
+    (void)numThreads;
+    PedacoFicheiro* p = &((PedacoFicheiro*)dados)[indiceThread];
+    for (Antena* a = p->primeira; a != NULL; a = a->prox) {
+        a->y += p->linhaBase + 1; // Coordenadas comeam em 1
+    }
+}
 
-    fclose(ficheiro);
+/**
+ * @brief L um ficheiro e cria a lista de antenas usando vrias threads.
+ *
+ * @param nomeFicheiro O nome do ficheiro a ser lido.
+ * @param lista A lista de antenas onde as novas antenas sero inseridas.
+ * @param numLinhas Ponteiro para a varivel que receber o nmero de linhas do mapa.
+ * @param numColunas Ponteiro para a varivel que receber o nmero de colunas do mapa.
+ * @param numThreads O nmero de threads a usar (se for <= 0, usa o nmero de processadores).
+ * @return A lista de antenas atualizada.
+ *
+ * @details
+ * O ficheiro  lido para memria e dividido em pedaos, um por thread, cada um a comear
+ * no incio de uma linha. Cada thread cria as antenas do seu pedao numa lista prpria.
+ * Depois de contar as linhas de cada pedao, as coordenadas Y so corrigidas (tambm em
+ * paralelo) e as listas so ligadas pela ordem do ficheiro, no fim da lista recebida.
+ * O resultado  o mesmo de `LerFicheiro`: mesmas antenas, pela mesma ordem, e o mesmo
+ * nmero de linhas e de colunas.
+ */
+Antena* LerFicheiroParalelo(char* nomeFicheiro, Antena* lista, int* numLinhas, int* numColunas, int numThreads)
+{
+    size_t tamanho = 0;
+    char* conteudo = LerConteudoFicheiro(nomeFicheiro, &tamanho);
+    if (conteudo == NULL) return lista;  // Se no conseguir ler, devolve a lista como est
+
+    if (numThreads <= 0) numThreads = NumeroProcessadores();
+    if ((size_t)numThreads > tamanho / TAMANHO_MINIMO_PEDACO) { // Pedaos pequenos no compensam
+        numThreads = (int)(tamanho / TAMANHO_MINIMO_PEDACO);
+    }
+    if (numThreads < 1) numThreads = 1;
+
+    PedacoFicheiro* pedacos = (PedacoFicheiro*)calloc(numThreads, sizeof(PedacoFicheiro));
+    if (pedacos == NULL) {
+        free(conteudo);
+        return lista;
+    }
+
+    // Divide o ficheiro em pedaos que comeam sempre no incio de uma linha
+    const char* fim = conteudo + tamanho;
+    const char* inicio = conteudo;
+    for (int t = 0; t < numThreads; t++) {
+        const char* corte = (t + 1 < numThreads) ? conteudo + tamanho / numThreads * (t + 1) : fim;
+        if (corte < inicio) corte = inicio;
+        while (corte < fim && corte[-1] != '\n') corte++;
+        pedacos[t].inicio = inicio;
+        pedacos[t].fim = corte;
+        inicio = corte;
+    }
+
+    NivelSimd(); // Escolhe a verso vetorial antes de lanar as threads
+    ExecutarEmParalelo(LerPedaco, pedacos, numThreads);
+
+    // Soma prefixa das linhas: cada pedao fica a saber em que linha comea
+    int linhas = 0, maxColunas = 0, erro = 0;
+    for (int t = 0; t < numThreads; t++) {
+        pedacos[t].linhaBase = linhas;
+        linhas += pedacos[t].numQuebras;
+        if (pedacos[t].maxColunas > maxColunas) maxColunas = pedacos[t].maxColunas;
+        if (pedacos[t].erro) erro = 1;
+    }
+
+    ExecutarEmParalelo(AjustarLinhasPedaco, pedacos, numThreads);
+
+    // Liga as listas dos pedaos, pela ordem do ficheiro, no fim da lista existente
+    Antena* ultima = lista;
+    while (ultima != NULL && ultima->prox != NULL) ultima = ultima->prox;
+    for (int t = 0; t < numThreads; t++) {
+        if (pedacos[t].primeira == NULL) continue;
+        if (ultima == NULL) lista = pedacos[t].primeira;
+        else ultima->prox = pedacos[t].primeira;
+        ultima = pedacos[t].ultima;
+    }
+
+    if (!erro) {
+        *numLinhas = linhas + 1;    // Tal como em LerFicheiro, a ltima linha conta mesmo sem '\n'
+        *numColunas = maxColunas;
+    }
+
+    free(pedacos);
+    free(conteudo);
     return lista;
-}
\ No newline at end of file
+}
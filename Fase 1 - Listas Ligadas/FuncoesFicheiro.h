@@ -30,4 +30,19 @@
   */
 Antena* LerFicheiro(char* nomeFicheiro, Antena* lista, int* numLinhas, int* numColunas);
 
+/**
+ * @brief L um ficheiro e insere as antenas na lista ligada, usando vrias threads.
+ *
+ * O ficheiro  dividido em pedaos alinhados s linhas, lidos em paralelo. O resultado
+ *  igual ao de `LerFicheiro`: as mesmas antenas, pela mesma ordem, e as mesmas dimenses.
+ *
+ * @param nomeFicheiro O nome do ficheiro que contm os dados das antenas.
+ * @param lista A lista de antenas onde as antenas lidas do ficheiro sero inseridas.
+ * @param numLinhas Ponteiro para varivel que armazenar o nmero de linhas do mapa.
+ * @param numColunas Ponteiro para varivel que armazenar o nmero de colunas do mapa.
+ * @param numThreads O nmero de threads a usar (se for <= 0, usa o nmero de processadores).
+ * @return A lista de antenas com as novas antenas inseridas.
+ */
+Antena* LerFicheiroParalelo(char* nomeFicheiro, Antena* lista, int* numLinhas, int* numColunas, int numThreads);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,534 @@
+/**
+ * @file FuncoesNefasto.c
+ * @brief Implementao das funes para calcular as localizaes com efeito nefasto.
+ *
+ * @details As antenas so primeiro agrupadas por frequncia (uma ordenao por contagem
+ * sobre os 256 valores possveis), para que s os pares da mesma frequncia sejam
+ * comparados. As localizaes so marcadas num mapa de bits com um bit por clula: uma
+ * localizao repetida custa apenas uma escrita, sem procurar numa lista, e o resultado
+ * sai ordenado por linha e coluna.
+ *
+ * Na verso paralela, os pares de cada frequncia so divididos em blocos de linhas i do
+ * tringulo de pares (i, j), com i < j, de tamanho semelhante, e as threads vo buscando
+ * blocos a uma fila partilhada. Cada thread marca as localizaes no seu prprio mapa de
+ * bits, e no fim os mapas so unidos (OR) em paralelo, cada thread com uma parte das
+ * palavras. Como a unio no depende da ordem, o resultado  igual ao da verso sequencial.
+ *
+ * No modo harmnico, todas as clulas da reta que passa por duas antenas da mesma frequncia
+ * so nefastas. O vetor entre as duas antenas  dividido pelo mximo divisor comum das suas
+ * componentes, o que d o menor passo inteiro sobre a reta; o intervalo de passos que fica
+ * dentro do mapa  calculado de uma vez e as clulas so marcadas sem testar as restantes.
+ * O custo de cada par  assim proporcional ao nmero de clulas que marca.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-03-30
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "Structs.h"
+#include "FuncoesNefasto.h"
+#include "FuncoesSimd.h"
+#include "FuncoesThreads.h"
+
+#define BLOCOS_POR_THREAD 8          // Blocos de pares por thread, para equilibrar a carga
+#define PARES_MINIMOS_BLOCO 65536    // Abaixo disto, dividir o trabalho no compensa
+
+/**
+ * @brief Bloco de pares de uma frequncia: as antenas i de iInicio a iFim - 1, cada uma com as seguintes.
+ */
+typedef struct BlocoPares {
+    const int* x;   /**< Coordenadas X das antenas da frequncia */
+    const int* y;   /**< Coordenadas Y das antenas da frequncia */
+    int n;          /**< Nmero de antenas da frequncia */
+    int iInicio;    /**< Primeira antena i do bloco */
+    int iFim;       /**< Fim (exclusivo) das antenas i do bloco */
+} BlocoPares;
+
+/**
+ * @brief Dados partilhados pelas threads do clculo paralelo.
+ */
+typedef struct TrabalhoNefastos {
+    BlocoPares* blocos;     /**< Blocos de pares a processar */
+    int numBlocos;          /**< Nmero de blocos */
+    volatile int proximo;   /**< Prximo bloco por atribuir */
+    int modo;               /**< NEFASTOS_REFLEXAO ou NEFASTOS_HARMONICOS */
+    MapaBits* mapas;        /**< Um mapa por thread (o da thread 0  o do resultado) */
+    size_t numPalavras;     /**< Nmero de palavras de cada mapa */
+} TrabalhoNefastos;
+
+/**
+ * @brief Agrupa as antenas por frequncia.
+ *
+ * @param lista A lista de antenas.
+ * @param grupos Ponteiro para a estrutura a preencher.
+ * @return 0 em caso de sucesso, -1 se faltar memria.
+ *
+ * @details
+ * A lista  percorrida duas vezes: na primeira conta-se o nmero de antenas de cada
+ * frequncia (o que d o incio de cada grupo) e na segunda copiam-se as coordenadas
+ * para a posio do seu grupo.
+ */
+int AgruparPorFrequencia(Antena* lista, GruposFrequencia* grupos)
+{
+    int contagem[256] = { 0 };
+    int total = 0;
+    for (Antena* a = lista; a != NULL; a = a->prox) {
+        contagem[(unsigned char)a->frequencia]++;
+        total++;
+    }
+
+    grupos->inicio[0] = 0;
+    for (int f = 0; f < 256; f++) {
+        grupos->inicio[f + 1] = grupos->inicio[f] + contagem[f];
+    }
+    grupos->total = total;
+    grupos->x = (int*)malloc((total > 0 ? total : 1) * sizeof(int));
+    grupos->y = (int*)malloc((total > 0 ? total : 1) * sizeof(int));
+    if (grupos->x == NULL || grupos->y == NULL) {
+        LibertarGrupos(grupos);
+        return -1;
+    }
+
+    int posicao[256];
+    memcpy(posicao, grupos->inicio, sizeof(posicao));
+    for (Antena* a = lista; a != NULL; a = a->prox) {
+        int i = posicao[(unsigned char)a->frequencia]++;
+        grupos->x[i] = a->x;
+        grupos->y[i] = a->y;
+    }
+    return 0;
+}
+
+/**
+ * @brief Liberta a memria dos grupos de frequncia.
+ *
+ * @param grupos Ponteiro para os grupos.
+ */
+void LibertarGrupos(GruposFrequencia* grupos)
+{
+    free(grupos->x);
+    free(grupos->y);
+    grupos->x = NULL;
+    grupos->y = NULL;
+    grupos->total = 0;
+}
+
+/**
+ * @brief Cria um mapa de bits vazio.
+ *
+ * @param mapa Ponteiro para o mapa a preencher.
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ * @return 0 em caso de sucesso, -1 se faltar memria.
+ */
+int CriarMapaBits(MapaBits* mapa, int numLinhas, int numColunas)
+{
+    if (numLinhas < 0) numLinhas = 0;
+    if (numColunas < 0) numColunas = 0;
+    size_t numPalavras = ((size_t)numLinhas * numColunas + 31) / 32;
+
+    mapa->numLinhas = numLinhas;
+    mapa->numColunas = numColunas;
+    mapa->palavras = (unsigned int*)calloc(numPalavras > 0 ? numPalavras : 1, sizeof(unsigned int));
+    return mapa->palavras != NULL ? 0 : -1;
+}
+
+/**
+ * @brief Liberta a memria de um mapa de bits.
+ *
+ * @param mapa Ponteiro para o mapa.
+ */
+void LibertarMapaBits(MapaBits* mapa)
+{
+    free(mapa->palavras);
+    mapa->palavras = NULL;
+}
+
+/**
+ * @brief Devolve o mximo divisor comum de dois inteiros no negativos.
+ */
+static int MaximoDivisorComum(int a, int b)
+{
+    while (b != 0) {
+        int r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+/**
+ * @brief Diviso inteira arredondada para baixo (b diferente de 0).
+ */
+static int DividirParaBaixo(int a, int b)
+{
+    int q = a / b;
+    if ((a % b != 0) && ((a < 0) != (b < 0))) q--;
+    return q;
+}
+
+/**
+ * @brief Restringe o intervalo [*tMin, *tMax] aos passos t com 1 <= a + t * passo <= limite.
+ */
+static void LimitarPassos(int a, int passo, int limite, int* tMin, int* tMax)
+{
+    if (passo == 0) return; // A coordenada no muda ao longo da reta
+    int inferior = 1 - a, superior = limite - a; // t * passo tem de ficar entre estes valores
+    int t0, t1;
+    if (passo > 0) {
+        t0 = -DividirParaBaixo(-inferior, passo); // Arredondado para cima
+        t1 = DividirParaBaixo(superior, passo);
+    }
+    else {
+        t0 = -DividirParaBaixo(-superior, passo);
+        t1 = DividirParaBaixo(inferior, passo);
+    }
+    if (t0 > *tMin) *tMin = t0;
+    if (t1 < *tMax) *tMax = t1;
+}
+
+/**
+ * @brief Marca todas as clulas do mapa sobre a reta que passa pelas antenas a e b.
+ *
+ * @details
+ * O passo (dx / g, dy / g), com g o mximo divisor comum de |dx| e |dy|,  o menor vetor inteiro
+ * da reta, pelo que as clulas da reta so exatamente a + t * passo. Se as duas antenas
+ * estiverem na mesma clula, s essa clula  marcada.
+ */
+static void MarcarLinha(int ax, int ay, int bx, int by, MapaBits* mapa)
+{
+    int dx = bx - ax, dy = by - ay;
+    int g = MaximoDivisorComum(dx < 0 ? -dx : dx, dy < 0 ? -dy : dy);
+    if (g == 0) g = 1;
+    int passoX = dx / g, passoY = dy / g;
+    if (passoX == 0 && (ax < 1 || ax > mapa->numColunas)) return; // Reta vertical fora do mapa
+    if (passoY == 0 && (ay < 1 || ay > mapa->numLinhas)) return;  // Reta horizontal fora do mapa
+
+    int tMin = 0, tMax = 0; // Se as antenas coincidem, s a sua clula
+    if (passoX != 0 || passoY != 0) {
+        tMin = INT_MIN;
+        tMax = INT_MAX;
+        LimitarPassos(ax, passoX, mapa->numColunas, &tMin, &tMax);
+        LimitarPassos(ay, passoY, mapa->numLinhas, &tMin, &tMax);
+    }
+
+    int x = ax + tMin * passoX, y = ay + tMin * passoY;
+    for (int t = tMin; t <= tMax; t++) {
+        size_t bit = (size_t)(y - 1) * mapa->numColunas + (x - 1);
+        mapa->palavras[bit / 32] |= 1u << (bit % 32);
+        x += passoX;
+        y += passoY;
+    }
+}
+
+/**
+ * @brief Marca as localizaes dos pares (i, j), com iInicio <= i < iFim e i < j < n.
+ */
+static void MarcarPares(const int* x, const int* y, int n, int iInicio, int iFim, int modo, MapaBits* mapa)
+{
+    for (int i = iInicio; i < iFim; i++) {
+        if (modo == NEFASTOS_HARMONICOS) {
+            for (int j = i + 1; j < n; j++) MarcarLinha(x[i], y[i], x[j], y[j], mapa);
+        }
+        else {
+            MarcarReflexoes(x[i], y[i], x + i + 1, y + i + 1, n - i - 1, mapa);
+        }
+    }
+}
+
+/**
+ * @brief Marca as localizaes nefastas dos pares de antenas de uma frequncia.
+ *
+ * @param x As coordenadas X das antenas.
+ * @param y As coordenadas Y das antenas.
+ * @param n O nmero de antenas.
+ * @param modo NEFASTOS_REFLEXAO ou NEFASTOS_HARMONICOS.
+ * @param mapa O mapa de bits.
+ *
+ * @details
+ * No modo de reflexo, para o par (a, b), com d = b - a, as localizaes so a - d e b + d.
+ * Cada antena  emparelhada com as seguintes por `MarcarReflexoes`, que trata 8 pares de cada
+ * vez quando o processador tem AVX2. No modo harmnico, so marcadas as clulas da reta do par.
+ */
+void MarcarNefastosFrequencia(const int* x, const int* y, int n, int modo, MapaBits* mapa)
+{
+    MarcarPares(x, y, n, 0, n, modo, mapa);
+}
+
+/**
+ * @brief Conta os bits a 1 de uma palavra.
+ */
+static int ContarBits(unsigned int p)
+{
+    int n = 0;
+    while (p != 0) {
+        p &= p - 1; // Apaga o bit a 1 menos significativo
+        n++;
+    }
+    return n;
+}
+
+/**
+ * @brief Cria o vetor de localizaes marcadas num mapa de bits.
+ *
+ * @param mapa O mapa de bits.
+ * @param numNefastos Ponteiro para a varivel que receber o nmero de localizaes (pode ser NULL).
+ * @return O vetor de localizaes ou NULL se no houver nenhuma ou faltar memria.
+ */
+Nefasto* NefastosDoMapa(const MapaBits* mapa, int* numNefastos)
+{
+    size_t numCelulas = (size_t)mapa->numLinhas * mapa->numColunas;
+    size_t numPalavras = (numCelulas + 31) / 32;
+    int total = 0;
+    for (size_t w = 0; w < numPalavras; w++) {
+        total += ContarBits(mapa->palavras[w]);
+    }
+    if (numNefastos != NULL) *numNefastos = 0;
+    if (total == 0) return NULL;
+
+    Nefasto* nefastos = (Nefasto*)malloc(total * sizeof(Nefasto));
+    if (nefastos == NULL) return NULL;
+
+    int k = 0;
+    for (size_t w = 0; w < numPalavras; w++) {
+        unsigned int p = mapa->palavras[w];
+        while (p != 0) {
+            int b = 0;
+            while (((p >> b) & 1u) == 0) b++;
+            p &= p - 1;
+
+            size_t celula = w * 32 + b;
+            nefastos[k].x = (int)(celula % mapa->numColunas) + 1;
+            nefastos[k].y = (int)(celula / mapa->numColunas) + 1;
+            nefastos[k].prox = k + 1 < total ? &nefastos[k + 1] : NULL;
+            k++;
+        }
+    }
+    if (numNefastos != NULL) *numNefastos = total;
+    return nefastos;
+}
+
+/**
+ * @brief Calcula as localizaes com efeito nefasto de uma lista de antenas.
+ *
+ * @param lista A lista de antenas.
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ * @param modo NEFASTOS_REFLEXAO ou NEFASTOS_HARMONICOS.
+ * @param numNefastos Ponteiro para a varivel que receber o nmero de localizaes (pode ser NULL).
+ * @return O vetor de localizaes ou NULL se no houver nenhuma ou faltar memria.
+ */
+Nefasto* CalcularNefastos(Antena* lista, int numLinhas, int numColunas, int modo, int* numNefastos)
+{
+    if (numNefastos != NULL) *numNefastos = 0;
+
+    GruposFrequencia grupos;
+    MapaBits mapa;
+    if (AgruparPorFrequencia(lista, &grupos) != 0) return NULL;
+    if (CriarMapaBits(&mapa, numLinhas, numColunas) != 0) {
+        LibertarGrupos(&grupos);
+        return NULL;
+    }
+
+    for (int f = 0; f < 256; f++) {
+        int inicio = grupos.inicio[f];
+        MarcarNefastosFrequencia(grupos.x + inicio, grupos.y + inicio, grupos.inicio[f + 1] - inicio, modo, &mapa);
+    }
+
+    Nefasto* nefastos = NefastosDoMapa(&mapa, numNefastos);
+    LibertarMapaBits(&mapa);
+    LibertarGrupos(&grupos);
+    return nefastos;
+}
+
+/**
+ * @brief Divide os pares de uma frequncia em blocos com cerca de `alvo` pares cada.
+ *
+ * @param x As coordenadas X das antenas.
+ * @param y As coordenadas Y das antenas.
+ * @param n O nmero de antenas.
+ * @param alvo O nmero de pares pretendido por bloco.
+ * @param blocos O vetor onde os blocos so escritos (se for NULL, s os conta).
+ * @return O nmero de blocos.
+ */
+static int DividirFrequencia(const int* x, const int* y, int n, long long alvo, BlocoPares* blocos)
+{
+    int numBlocos = 0;
+    int i = 0;
+    while (i + 1 < n) {
+        int inicio = i;
+        long long pares = 0;
+        while (i + 1 < n && pares < alvo) {
+            pares += n - 1 - i; // A antena i  emparelhada com as n - 1 - i seguintes
+            i++;
+        }
+        if (blocos != NULL) {
+            blocos[numBlocos].x = x;
+            blocos[numBlocos].y = y;
+            blocos[numBlocos].n = n;
+            blocos[numBlocos].iInicio = inicio;
+            blocos[numBlocos].iFim = i;
+        }
+        numBlocos++;
+    }
+    return numBlocos;
+}
+
+/**
+ * @brief Tarefa de cada thread: processa blocos da fila at se esgotarem, no seu prprio mapa.
+ */
+static void MarcarBlocos(void* dados, int indiceThread, int numThreads)
+{
+    TrabalhoNefastos* t = (TrabalhoNefastos*)dados;
+    MapaBits* mapa = &t->mapas[indiceThread];
+    (void)numThreads;
+
+    int b;
+    while ((b = SomarAtomicoInteiro(&t->proximo, 1)) < t->numBlocos) {
+        const BlocoPares* bloco = &t->blocos[b];
+        MarcarPares(bloco->x, bloco->y, bloco->n, bloco->iInicio, bloco->iFim, t->modo, mapa);
+    }
+}
+
+/**
+ * @brief Tarefa de cada thread: junta ao mapa da thread 0 uma parte das palavras dos restantes mapas.
+ */
+static void UnirMapas(void* dados, int indiceThread, int numThreads)
+{
+    TrabalhoNefastos* t = (TrabalhoNefastos*)dados;
+    size_t inicio = t->numPalavras * indiceThread / numThreads;
+    size_t fim = t->numPalavras * (indiceThread + 1) / numThreads;
+    unsigned int* destino = t->mapas[0].palavras;
+
+    for (int m = 1; m < numThreads; m++) {
+        const unsigned int* origem = t->mapas[m].palavras;
+        for (size_t w = inicio; w < fim; w++) destino[w] |= origem[w];
+    }
+}
+
+/**
+ * @brief Calcula as localizaes com efeito nefasto usando vrias threads.
+ *
+ * @param lista A lista de antenas.
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ * @param modo NEFASTOS_REFLEXAO ou NEFASTOS_HARMONICOS.
+ * @param numNefastos Ponteiro para a varivel que receber o nmero de localizaes (pode ser NULL).
+ * @param numThreads O nmero de threads a usar (se for <= 0, usa o nmero de processadores).
+ * @param paresMinimos O nmero mnimo de pares por thread (se for <= 0, usa PARES_MINIMOS_BLOCO).
+ * @return O vetor de localizaes ou NULL se no houver nenhuma ou faltar memria.
+ *
+ * @details
+ * O nmero de pares de todas as frequncias define o tamanho dos blocos (cerca de
+ * BLOCOS_POR_THREAD blocos por thread), para que uma frequncia grande seja repartida por
+ * vrias threads e as pequenas fiquem num nico bloco. Com poucos pares, ou se faltar
+ * memria para os mapas de cada thread, o clculo  feito s pela thread que chama.
+ */
+Nefasto* CalcularNefastosParaleloMinimo(Antena* lista, int numLinhas, int numColunas, int modo, int* numNefastos,
+    int numThreads, long long paresMinimos)
+{
+    if (numNefastos != NULL) *numNefastos = 0;
+    if (numThreads <= 0) numThreads = NumeroProcessadores();
+    if (paresMinimos <= 0) paresMinimos = PARES_MINIMOS_BLOCO;
+
+    GruposFrequencia grupos;
+    if (AgruparPorFrequencia(lista, &grupos) != 0) return NULL;
+
+    long long totalPares = 0;
+    for (int f = 0; f < 256; f++) {
+        long long n = grupos.inicio[f + 1] - grupos.inicio[f];
+        totalPares += n * (n - 1) / 2;
+    }
+    if (totalPares / paresMinimos < numThreads) numThreads = (int)(totalPares / paresMinimos);
+    if (numThreads < 1) numThreads = 1;
+
+    long long alvo = totalPares / ((long long)numThreads * BLOCOS_POR_THREAD);
+    if (alvo < 1) alvo = 1;
+
+    // Divide cada frequncia em blocos (primeiro conta-os, depois preenche-os)
+    int numBlocos = 0;
+    for (int f = 0; f < 256; f++) {
+        int inicio = grupos.inicio[f];
+        numBlocos += DividirFrequencia(grupos.x + inicio, grupos.y + inicio, grupos.inicio[f + 1] - inicio, alvo, NULL);
+    }
+
+    TrabalhoNefastos trabalho;
+    trabalho.blocos = (BlocoPares*)malloc((numBlocos > 0 ? numBlocos : 1) * sizeof(BlocoPares));
+    trabalho.mapas = (MapaBits*)calloc(numThreads, sizeof(MapaBits));
+    if (trabalho.blocos == NULL || trabalho.mapas == NULL || CriarMapaBits(&trabalho.mapas[0], numLinhas, numColunas) != 0) {
+        free(trabalho.blocos);
+        free(trabalho.mapas);
+        LibertarGrupos(&grupos);
+        return NULL;
+    }
+    trabalho.numBlocos = 0;
+    for (int f = 0; f < 256; f++) {
+        int inicio = grupos.inicio[f];
+        trabalho.numBlocos += DividirFrequencia(grupos.x + inicio, grupos.y + inicio, grupos.inicio[f + 1] - inicio,
+            alvo, trabalho.blocos + trabalho.numBlocos);
+    }
+    trabalho.proximo = 0;
+    trabalho.modo = modo;
+    trabalho.numPalavras = ((size_t)trabalho.mapas[0].numLinhas * trabalho.mapas[0].numColunas + 31) / 32;
+
+    // Mapas privados das restantes threads; se faltar memria, usa s as que j os tm
+    int criados = 1;
+    while (criados < numThreads && CriarMapaBits(&trabalho.mapas[criados], numLinhas, numColunas) == 0) criados++;
+    numThreads = criados;
+
+    NivelSimd(); // Escolhe a verso vetorial antes de lanar as threads
+    ExecutarEmParalelo(MarcarBlocos, &trabalho, numThreads);
+    if (numThreads > 1) ExecutarEmParalelo(UnirMapas, &trabalho, numThreads);
+
+    Nefasto* nefastos = NefastosDoMapa(&trabalho.mapas[0], numNefastos);
+    for (int m = 0; m < numThreads; m++) LibertarMapaBits(&trabalho.mapas[m]);
+    free(trabalho.mapas);
+    free(trabalho.blocos);
+    LibertarGrupos(&grupos);
+    return nefastos;
+}
+
+/**
+ * @brief Calcula as localizaes com efeito nefasto usando vrias threads, s quando h pelo
+ * menos PARES_MINIMOS_BLOCO pares por thread.
+ *
+ * @param lista A lista de antenas.
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ * @param modo NEFASTOS_REFLEXAO ou NEFASTOS_HARMONICOS.
+ * @param numNefastos Ponteiro para a varivel que receber o nmero de localizaes (pode ser NULL).
+ * @param numThreads O nmero de threads a usar (se for <= 0, usa o nmero de processadores).
+ * @return O vetor de localizaes ou NULL se no houver nenhuma ou faltar memria.
+ */
+Nefasto* CalcularNefastosParalelo(Antena* lista, int numLinhas, int numColunas, int modo, int* numNefastos, int numThreads)
+{
+    return CalcularNefastosParaleloMinimo(lista, numLinhas, numColunas, modo, numNefastos, numThreads, PARES_MINIMOS_BLOCO);
+}
+
+/**
+ * @brief Lista as localizaes com efeito nefasto.
+ *
+ * @param lista A lista de localizaes.
+ */
+void ListarNefastos(Nefasto* lista)
+{
+    for (Nefasto* n = lista; n != NULL; n = n->prox) {
+        printf("Localizao nefasta: (%d, %d)\n", n->y, n->x);
+    }
+}
+
+/**
+ * @brief Liberta as localizaes criadas por NefastosDoMapa ou CalcularNefastos.
+ *
+ * @param nefastos O vetor de localizaes.
+ * @return NULL
+ */
+Nefasto* DestroiNefastos(Nefasto* nefastos)
+{
+    free(nefastos); // Um nico bloco para todas as localizaes
+    return NULL;
+}
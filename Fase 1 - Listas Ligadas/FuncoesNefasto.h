@@ -0,0 +1,148 @@
+/**
+ * @file FuncoesNefasto.h
+ * @brief Declarao das funes para calcular as localizaes com efeito nefasto.
+ *
+ * @details Duas antenas a e b com a mesma frequncia provocam um efeito nefasto nas posies
+ * 2a - b e 2b - a (o ponto alinhado com as duas antenas, duas vezes mais longe de uma do que
+ * da outra). Este ficheiro contm as declaraes das funes que agrupam as antenas por
+ * frequncia, marcam essas posies num mapa de bits e devolvem as localizaes encontradas.
+ * No modo harmnico, todas as clulas da reta que passa pelas duas antenas so nefastas.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-03-30
+ * @version 1.0
+ */
+
+#ifndef FUNCOESNEFASTO_H
+#define FUNCOESNEFASTO_H
+
+#include "Structs.h"
+
+#define NEFASTOS_REFLEXAO 0     // S as posies 2a - b e 2b - a de cada par
+#define NEFASTOS_HARMONICOS 1   // Todas as clulas da reta que passa pelas duas antenas (s a sua, se coincidirem)
+
+ /**
+  * @brief Agrupa as antenas de uma lista por frequncia.
+  *
+  * @param lista A lista de antenas.
+  * @param grupos Ponteiro para a estrutura a preencher.
+  * @return 0 em caso de sucesso, -1 se faltar memria.
+  */
+int AgruparPorFrequencia(Antena* lista, GruposFrequencia* grupos);
+
+/**
+ * @brief Liberta a memria dos grupos de frequncia.
+ *
+ * @param grupos Ponteiro para os grupos.
+ */
+void LibertarGrupos(GruposFrequencia* grupos);
+
+/**
+ * @brief Cria um mapa de bits vazio com as dimenses do mapa.
+ *
+ * @param mapa Ponteiro para o mapa a preencher.
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ * @return 0 em caso de sucesso, -1 se faltar memria.
+ */
+int CriarMapaBits(MapaBits* mapa, int numLinhas, int numColunas);
+
+/**
+ * @brief Liberta a memria de um mapa de bits.
+ *
+ * @param mapa Ponteiro para o mapa.
+ */
+void LibertarMapaBits(MapaBits* mapa);
+
+/**
+ * @brief Marca no mapa de bits as localizaes nefastas dos pares de antenas de uma frequncia.
+ *
+ * As posies fora do mapa so ignoradas.
+ *
+ * @param x As coordenadas X das antenas da frequncia.
+ * @param y As coordenadas Y das antenas da frequncia.
+ * @param n O nmero de antenas.
+ * @param modo NEFASTOS_REFLEXAO ou NEFASTOS_HARMONICOS.
+ * @param mapa O mapa de bits onde as localizaes so marcadas.
+ */
+void MarcarNefastosFrequencia(const int* x, const int* y, int n, int modo, MapaBits* mapa);
+
+/**
+ * @brief Cria as localizaes nefastas marcadas num mapa de bits.
+ *
+ * As localizaes ficam num nico vetor, por ordem de linha e coluna, e cada uma aponta
+ * para a seguinte (`prox`), pelo que o resultado pode ser usado como vetor ou como lista.
+ *
+ * @param mapa O mapa de bits.
+ * @param numNefastos Ponteiro para a varivel que receber o nmero de localizaes (pode ser NULL).
+ * @return O vetor de localizaes (a libertar com DestroiNefastos) ou NULL se no houver nenhuma
+ * ou faltar memria.
+ */
+Nefasto* NefastosDoMapa(const MapaBits* mapa, int* numNefastos);
+
+/**
+ * @brief Calcula as localizaes com efeito nefasto de uma lista de antenas.
+ *
+ * S os pares de antenas com a mesma frequncia so comparados, e cada localizao aparece
+ * uma nica vez, mesmo que resulte de vrios pares.
+ *
+ * @param lista A lista de antenas.
+ * @param numLinhas O nmero de linhas do mapa (tal como devolvido por LerFicheiro).
+ * @param numColunas O nmero de colunas do mapa (tal como devolvido por LerFicheiro).
+ * @param modo NEFASTOS_REFLEXAO ou NEFASTOS_HARMONICOS.
+ * @param numNefastos Ponteiro para a varivel que receber o nmero de localizaes (pode ser NULL).
+ * @return O vetor de localizaes (ver NefastosDoMapa) ou NULL se no houver nenhuma ou faltar memria.
+ */
+Nefasto* CalcularNefastos(Antena* lista, int numLinhas, int numColunas, int modo, int* numNefastos);
+
+/**
+ * @brief Calcula as localizaes com efeito nefasto usando vrias threads.
+ *
+ * O trabalho  dividido por frequncia e, nas frequncias com muitas antenas, por blocos de
+ * pares. O resultado  igual ao de `CalcularNefastos`: as mesmas localizaes, pela mesma ordem.
+ *
+ * @param lista A lista de antenas.
+ * @param numLinhas O nmero de linhas do mapa (tal como devolvido por LerFicheiro).
+ * @param numColunas O nmero de colunas do mapa (tal como devolvido por LerFicheiro).
+ * @param modo NEFASTOS_REFLEXAO ou NEFASTOS_HARMONICOS.
+ * @param numNefastos Ponteiro para a varivel que receber o nmero de localizaes (pode ser NULL).
+ * @param numThreads O nmero de threads a usar (se for <= 0, usa o nmero de processadores).
+ * @return O vetor de localizaes (ver NefastosDoMapa) ou NULL se no houver nenhuma ou faltar memria.
+ */
+Nefasto* CalcularNefastosParalelo(Antena* lista, int numLinhas, int numColunas, int modo, int* numNefastos, int numThreads);
+
+/**
+ * @brief Verso de `CalcularNefastosParalelo` com o nmero mnimo de pares por thread indicado.
+ *
+ * Cada thread tem de ter pelo menos `paresMinimos` pares; se no houver pares suficientes,
+ * usa menos threads. Com `paresMinimos` = 1, mesmo um mapa pequeno  repartido por vrias
+ * threads, o que serve para verificar a verso paralela.
+ *
+ * @param lista A lista de antenas.
+ * @param numLinhas O nmero de linhas do mapa (tal como devolvido por LerFicheiro).
+ * @param numColunas O nmero de colunas do mapa (tal como devolvido por LerFicheiro).
+ * @param modo NEFASTOS_REFLEXAO ou NEFASTOS_HARMONICOS.
+ * @param numNefastos Ponteiro para a varivel que receber o nmero de localizaes (pode ser NULL).
+ * @param numThreads O nmero de threads a usar (se for <= 0, usa o nmero de processadores).
+ * @param paresMinimos O nmero mnimo de pares por thread (se for <= 0, usa o valor por omisso).
+ * @return O vetor de localizaes (ver NefastosDoMapa) ou NULL se no houver nenhuma ou faltar memria.
+ */
+Nefasto* CalcularNefastosParaleloMinimo(Antena* lista, int numLinhas, int numColunas, int modo, int* numNefastos,
+    int numThreads, long long paresMinimos);
+
+/**
+ * @brief Lista as localizaes com efeito nefasto.
+ *
+ * @param lista A lista de localizaes.
+ */
+void ListarNefastos(Nefasto* lista);
+
+/**
+ * @brief Liberta as localizaes criadas por NefastosDoMapa ou CalcularNefastos.
+ *
+ * @param nefastos O vetor de localizaes.
+ * @return NULL
+ */
+Nefasto* DestroiNefastos(Nefasto* nefastos);
+
+#endif
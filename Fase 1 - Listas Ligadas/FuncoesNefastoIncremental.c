@@ -0,0 +1,255 @@
+/**
+ * @file FuncoesNefastoIncremental.c
+ * @brief Implementao das funes que mantm as localizaes nefastas ao inserir e remover antenas.
+ *
+ * @details Cada par de antenas (a, b) da mesma frequncia soma 1  contagem das clulas
+ * 2a - b e 2b - a que estejam dentro do mapa. Ao inserir uma antena somam-se os pares que ela
+ * forma com as antenas da sua frequncia; ao remov-la subtraem-se os mesmos pares. Uma clula
+ * passa a nefasta quando a contagem sai de 0 e deixa de o ser quando volta a 0, pelo que o
+ * nmero de localizaes est sempre atualizado.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-03-30
+ * @version 1.0
+ */
+
+#include <stdlib.h>
+#include "Structs.h"
+#include "FuncoesAntena.h"
+#include "FuncoesNefastoIncremental.h"
+
+/**
+ * @brief Soma `delta`  contagem de uma clula, se estiver dentro dos limites.
+ */
+static void AlterarCelula(ConjuntoNefastos* conjunto, int x, int y, int delta)
+{
+    if (x < 1 || x > conjunto->numColunas || y < 1 || y > conjunto->numLinhas) return;
+    int* contagem = &conjunto->contagens[(size_t)(y - 1) * conjunto->numColunas + (x - 1)];
+    if (*contagem == 0) conjunto->numNefastos++;     // A clula passa a nefasta
+    *contagem += delta;
+    if (*contagem == 0) conjunto->numNefastos--;     // A clula deixa de ser nefasta
+}
+
+/**
+ * @brief Soma `delta` s clulas dos pares que a antena (x, y) forma com as antenas de uma frequncia.
+ */
+static void AlterarPares(ConjuntoNefastos* conjunto, const AntenasFrequencia* grupo, int x, int y, int delta)
+{
+    for (int j = 0; j < grupo->n; j++) {
+        int dx = grupo->x[j] - x;
+        int dy = grupo->y[j] - y;
+        AlterarCelula(conjunto, x - dx, y - dy, delta);
+        AlterarCelula(conjunto, grupo->x[j] + dx, grupo->y[j] + dy, delta);
+    }
+}
+
+/**
+ * @brief Cria o conjunto de localizaes nefastas de uma lista de antenas.
+ *
+ * @param conjunto Ponteiro para o conjunto a preencher.
+ * @param lista A lista de antenas.
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ * @return 0 em caso de sucesso, -1 se faltar memria (o conjunto fica vazio).
+ *
+ * @details
+ * As antenas da lista so acrescentadas uma a uma, o que d exatamente os pares de cada frequncia.
+ */
+int CriarConjuntoNefastos(ConjuntoNefastos* conjunto, Antena* lista, int numLinhas, int numColunas)
+{
+    if (numLinhas < 0) numLinhas = 0;
+    if (numColunas < 0) numColunas = 0;
+    size_t numCelulas = (size_t)numLinhas * numColunas;
+
+    for (int f = 0; f < 256; f++) {
+        conjunto->frequencias[f].x = NULL;
+        conjunto->frequencias[f].y = NULL;
+        conjunto->frequencias[f].n = 0;
+        conjunto->frequencias[f].capacidade = 0;
+    }
+    conjunto->numLinhas = numLinhas;
+    conjunto->numColunas = numColunas;
+    conjunto->numNefastos = 0;
+    conjunto->contagens = (int*)calloc(numCelulas > 0 ? numCelulas : 1, sizeof(int));
+    if (conjunto->contagens == NULL) return -1;
+
+    for (Antena* a = lista; a != NULL; a = a->prox) {
+        if (AdicionarAntenaNefastos(conjunto, a->frequencia, a->x, a->y) != 0) {
+            LibertarConjuntoNefastos(conjunto);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Liberta a memria de um conjunto de localizaes nefastas.
+ *
+ * @param conjunto Ponteiro para o conjunto.
+ */
+void LibertarConjuntoNefastos(ConjuntoNefastos* conjunto)
+{
+    for (int f = 0; f < 256; f++) {
+        free(conjunto->frequencias[f].x);
+        free(conjunto->frequencias[f].y);
+        conjunto->frequencias[f].x = NULL;
+        conjunto->frequencias[f].y = NULL;
+        conjunto->frequencias[f].n = 0;
+        conjunto->frequencias[f].capacidade = 0;
+    }
+    free(conjunto->contagens);
+    conjunto->contagens = NULL;
+    conjunto->numNefastos = 0;
+}
+
+/**
+ * @brief Acrescenta uma antena ao conjunto.
+ *
+ * @param conjunto Ponteiro para o conjunto.
+ * @param freq A frequncia da antena.
+ * @param x A coordenada X da antena.
+ * @param y A coordenada Y da antena.
+ * @return 0 em caso de sucesso, -1 se faltar memria (o conjunto no  alterado).
+ *
+ * @details
+ * Os vetores da frequncia crescem para o dobro quando esto cheios, antes de alterar as
+ * contagens, para que uma falta de memria no deixe o conjunto a meio.
+ */
+int AdicionarAntenaNefastos(ConjuntoNefastos* conjunto, char freq, int x, int y)
+{
+    AntenasFrequencia* grupo = &conjunto->frequencias[(unsigned char)freq];
+
+    if (grupo->n == grupo->capacidade) {
+        int capacidade = grupo->capacidade > 0 ? grupo->capacidade * 2 : 8;
+        int* novoX = (int*)realloc(grupo->x, capacidade * sizeof(int));
+        if (novoX == NULL) return -1;
+        grupo->x = novoX;
+        int* novoY = (int*)realloc(grupo->y, capacidade * sizeof(int));
+        if (novoY == NULL) return -1;
+        grupo->y = novoY;
+        grupo->capacidade = capacidade;
+    }
+
+    AlterarPares(conjunto, grupo, x, y, 1);
+    grupo->x[grupo->n] = x;
+    grupo->y[grupo->n] = y;
+    grupo->n++;
+    return 0;
+}
+
+/**
+ * @brief Retira uma antena do conjunto.
+ *
+ * @param conjunto Ponteiro para o conjunto.
+ * @param freq A frequncia da antena.
+ * @param x A coordenada X da antena.
+ * @param y A coordenada Y da antena.
+ * @return 0 em caso de sucesso, -1 se a antena no estiver no conjunto.
+ *
+ * @details
+ * A antena  trocada pela ltima da sua frequncia, porque a ordem dentro da frequncia no
+ * altera as contagens.
+ */
+int RetirarAntenaNefastos(ConjuntoNefastos* conjunto, char freq, int x, int y)
+{
+    AntenasFrequencia* grupo = &conjunto->frequencias[(unsigned char)freq];
+
+    int i = 0;
+    while (i < grupo->n && (grupo->x[i] != x || grupo->y[i] != y)) i++;
+    if (i == grupo->n) return -1;
+
+    grupo->n--;
+    grupo->x[i] = grupo->x[grupo->n];
+    grupo->y[i] = grupo->y[grupo->n];
+    AlterarPares(conjunto, grupo, x, y, -1); // Pares com as restantes antenas da frequncia
+    return 0;
+}
+
+/**
+ * @brief Insere uma antena no incio da lista e atualiza o conjunto.
+ *
+ * @param lista A lista de antenas.
+ * @param conjunto Ponteiro para o conjunto da lista.
+ * @param freq A frequncia da nova antena.
+ * @param x A coordenada X da nova antena.
+ * @param y A coordenada Y da nova antena.
+ * @return A lista atualizada (sem alteraes se faltar memria).
+ *
+ * @details
+ * A insero  a de InserirAntenaInicio, em tempo constante: o conjunto no depende da ordem
+ * da lista, e percorrer a lista at ao fim custaria tanto como a prpria atualizao. Se a
+ * antena no puder ser criada, a alterao do conjunto  desfeita, para que a lista e o
+ * conjunto fiquem sempre com as mesmas antenas.
+ */
+Antena* InserirAntenaNefastos(Antena* lista, ConjuntoNefastos* conjunto, char freq, int x, int y)
+{
+    if (AdicionarAntenaNefastos(conjunto, freq, x, y) != 0) return lista;
+
+    Antena* novaLista = InserirAntenaInicio(lista, freq, x, y);
+    if (novaLista == lista) { // Falta de memria: a antena no entrou na lista
+        RetirarAntenaNefastos(conjunto, freq, x, y);
+    }
+    return novaLista;
+}
+
+/**
+ * @brief Remove uma antena da lista e atualiza o conjunto.
+ *
+ * @param lista A lista de antenas.
+ * @param conjunto Ponteiro para o conjunto da lista.
+ * @param x A coordenada X da antena a remover.
+ * @param y A coordenada Y da antena a remover.
+ * @param resultado Ponteiro para a varivel que receber 0 se a antena foi removida, -1 se no
+ * existir na lista, ou -2 se existir na lista mas no no conjunto (pode ser NULL).
+ * @return A lista atualizada (sem alteraes se a antena no for removida).
+ *
+ * @details
+ * A frequncia da antena  obtida da prpria lista, e a antena removida da lista  a
+ * mesma que RemoverAntena remove (a primeira com essas coordenadas). Se o conjunto no tiver
+ * a antena, no corresponde  lista: a lista no  alterada e o erro  devolvido ao chamador.
+ */
+Antena* RemoverAntenaNefastos(Antena* lista, ConjuntoNefastos* conjunto, int x, int y, int* resultado)
+{
+    if (resultado != NULL) *resultado = -1;
+    Antena* aux = lista;
+    while (aux != NULL && (aux->x != x || aux->y != y)) aux = aux->prox;
+    if (aux == NULL) return lista;
+
+    if (RetirarAntenaNefastos(conjunto, aux->frequencia, x, y) != 0) {
+        if (resultado != NULL) *resultado = -2;
+        return lista;
+    }
+    if (resultado != NULL) *resultado = 0;
+    return RemoverAntena(lista, x, y);
+}
+
+/**
+ * @brief Cria as localizaes nefastas atuais do conjunto.
+ *
+ * @param conjunto Ponteiro para o conjunto.
+ * @param numNefastos Ponteiro para a varivel que receber o nmero de localizaes (pode ser NULL).
+ * @return O vetor de localizaes ou NULL se no houver nenhuma ou faltar memria.
+ */
+Nefasto* NefastosDoConjunto(const ConjuntoNefastos* conjunto, int* numNefastos)
+{
+    if (numNefastos != NULL) *numNefastos = 0;
+    int total = conjunto->numNefastos;
+    if (total == 0) return NULL;
+
+    Nefasto* nefastos = (Nefasto*)malloc(total * sizeof(Nefasto));
+    if (nefastos == NULL) return NULL;
+
+    int k = 0;
+    for (int y = 1; y <= conjunto->numLinhas; y++) {
+        const int* linha = conjunto->contagens + (size_t)(y - 1) * conjunto->numColunas;
+        for (int x = 1; x <= conjunto->numColunas; x++) {
+            if (linha[x - 1] == 0) continue;
+            nefastos[k].x = x;
+            nefastos[k].y = y;
+            nefastos[k].prox = k + 1 < total ? &nefastos[k + 1] : NULL;
+            k++;
+        }
+    }
+    if (numNefastos != NULL) *numNefastos = total;
+    return nefastos;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file FuncoesNefastoIncremental.h
+ * @brief Declarao das funes que mantm as localizaes nefastas ao inserir e remover antenas.
+ *
+ * @details Em vez de recalcular todas as localizaes depois de cada alterao, o conjunto
+ * guarda, para cada clula, o nmero de pares de antenas que a tornam nefasta. Inserir ou
+ * remover uma antena s altera as clulas dos pares que ela forma com as k antenas da mesma
+ * frequncia, pelo que cada alterao custa O(k) em vez de O(n).
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-03-30
+ * @version 1.0
+ */
+
+#ifndef FUNCOESNEFASTOINCREMENTAL_H
+#define FUNCOESNEFASTOINCREMENTAL_H
+
+#include "Structs.h"
+
+ /**
+  * @brief Cria o conjunto de localizaes nefastas de uma lista de antenas.
+  *
+  * @param conjunto Ponteiro para o conjunto a preencher.
+  * @param lista A lista de antenas.
+  * @param numLinhas O nmero de linhas do mapa (tal como devolvido por LerFicheiro).
+  * @param numColunas O nmero de colunas do mapa (tal como devolvido por LerFicheiro).
+  * @return 0 em caso de sucesso, -1 se faltar memria (o conjunto fica vazio).
+  */
+int CriarConjuntoNefastos(ConjuntoNefastos* conjunto, Antena* lista, int numLinhas, int numColunas);
+
+/**
+ * @brief Liberta a memria de um conjunto de localizaes nefastas.
+ *
+ * @param conjunto Ponteiro para o conjunto.
+ */
+void LibertarConjuntoNefastos(ConjuntoNefastos* conjunto);
+
+/**
+ * @brief Acrescenta uma antena ao conjunto, marcando as localizaes dos pares que ela forma.
+ *
+ * @param conjunto Ponteiro para o conjunto.
+ * @param freq A frequncia da antena.
+ * @param x A coordenada X da antena.
+ * @param y A coordenada Y da antena.
+ * @return 0 em caso de sucesso, -1 se faltar memria (o conjunto no  alterado).
+ */
+int AdicionarAntenaNefastos(ConjuntoNefastos* conjunto, char freq, int x, int y);
+
+/**
+ * @brief Retira uma antena do conjunto, desmarcando as localizaes dos pares que ela formava.
+ *
+ * @param conjunto Ponteiro para o conjunto.
+ * @param freq A frequncia da antena.
+ * @param x A coordenada X da antena.
+ * @param y A coordenada Y da antena.
+ * @return 0 em caso de sucesso, -1 se a antena no estiver no conjunto.
+ */
+int RetirarAntenaNefastos(ConjuntoNefastos* conjunto, char freq, int x, int y);
+
+/**
+ * @brief Insere uma antena no incio da lista (como InserirAntenaInicio) e atualiza o conjunto.
+ *
+ * @param lista A lista de antenas.
+ * @param conjunto Ponteiro para o conjunto da lista.
+ * @param freq A frequncia da nova antena.
+ * @param x A coordenada X da nova antena.
+ * @param y A coordenada Y da nova antena.
+ * @return A lista atualizada (sem alteraes se faltar memria).
+ */
+Antena* InserirAntenaNefastos(Antena* lista, ConjuntoNefastos* conjunto, char freq, int x, int y);
+
+/**
+ * @brief Remove uma antena da lista (como RemoverAntena) e atualiza o conjunto.
+ *
+ * @param lista A lista de antenas.
+ * @param conjunto Ponteiro para o conjunto da lista.
+ * @param x A coordenada X da antena a remover.
+ * @param y A coordenada Y da antena a remover.
+ * @param resultado Recebe 0 se a antena foi removida, -1 se no existir na lista, ou -2 se
+ * existir na lista mas no no conjunto (pode ser NULL).
+ * @return A lista atualizada (sem alteraes se a antena no for removida).
+ */
+Antena* RemoverAntenaNefastos(Antena* lista, ConjuntoNefastos* conjunto, int x, int y, int* resultado);
+
+/**
+ * @brief Cria as localizaes nefastas atuais do conjunto.
+ *
+ * O resultado tem o mesmo formato (e, para as mesmas antenas, o mesmo contedo) do de
+ * `CalcularNefastos` no modo NEFASTOS_REFLEXAO.
+ *
+ * @param conjunto Ponteiro para o conjunto.
+ * @param numNefastos Ponteiro para a varivel que receber o nmero de localizaes (pode ser NULL).
+ * @return O vetor de localizaes (a libertar com DestroiNefastos) ou NULL se no houver nenhuma
+ * ou faltar memria.
+ */
+Nefasto* NefastosDoConjunto(const ConjuntoNefastos* conjunto, int* numNefastos);
+
+#endif
@@ -0,0 +1,273 @@
+/**
+ * @file FuncoesSimd.c
+ * @brief Implementao das funes vetorizadas de leitura do mapa e de clculo dos nefastos.
+ *
+ * @details Os mapas so quase todos '.', pelo que a leitura passa a maior parte do tempo
+ * a saltar clulas vazias. A funo `ProximaCelulaOcupada` compara blocos de 16 (SSE2) ou
+ * 32 (AVX2) caracteres com '.' e obtm uma mscara com um bit por caracter; o primeiro bit
+ * a 0 indica a prxima antena ou quebra de linha. Nos processadores sem estas instrues
+ *  usada uma verso escalar.
+ *
+ * A funo `MarcarReflexoes` calcula as localizaes nefastas de 8 pares de uma vez (AVX2):
+ * as duas reflexes e a verificao dos limites do mapa so feitas com operaes vetoriais,
+ * e s as posies dentro do mapa so escritas no mapa de bits. Como o AVX2 no tem escrita
+ * dispersa, essas escritas so feitas uma a uma, a partir da mscara das posies vlidas.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-03-30
+ * @version 1.0
+ */
+
+#include <limits.h>
+#include "Structs.h"
+#include "FuncoesSimd.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// GCC e Clang s geram instrues AVX2 em funes marcadas para isso
+#if defined(__GNUC__) || defined(__clang__)
+#define ALVO_SSE2 __attribute__((target("sse2")))
+#define ALVO_AVX2 __attribute__((target("avx2")))
+#else
+#define ALVO_SSE2
+#define ALVO_AVX2
+#endif
+
+typedef const char* (*FuncaoProcura)(const char* p, const char* fim);
+typedef void (*FuncaoReflexoes)(int ax, int ay, const int* x, const int* y, int n, MapaBits* mapa);
+
+static int nivel = -1;          // Nvel escolhido (-1 enquanto no for detetado)
+static FuncaoProcura procurar;  // Verso da procura em uso
+static FuncaoReflexoes refletir; // Verso do clculo dos nefastos em uso
+
+/**
+ * @brief Verso escalar: avana caracter a caracter.
+ */
+static const char* ProcurarEscalar(const char* p, const char* fim)
+{
+    while (p < fim && *p == '.') p++;
+    return p;
+}
+
+/**
+ * @brief Marca uma clula do mapa, se estiver dentro dos limites.
+ */
+static void MarcarCelula(MapaBits* mapa, int x, int y)
+{
+    if (x < 1 || x > mapa->numColunas || y < 1 || y > mapa->numLinhas) return;
+    size_t bit = (size_t)(y - 1) * mapa->numColunas + (x - 1);
+    mapa->palavras[bit / 32] |= 1u << (bit % 32);
+}
+
+/**
+ * @brief Verso escalar: marca as reflexes de um par de cada vez.
+ */
+static void RefletirEscalar(int ax, int ay, const int* x, const int* y, int n, MapaBits* mapa)
+{
+    for (int j = 0; j < n; j++) {
+        int dx = x[j] - ax;
+        int dy = y[j] - ay;
+        MarcarCelula(mapa, ax - dx, ay - dy);
+        MarcarCelula(mapa, x[j] + dx, y[j] + dy);
+    }
+}
+
+#ifdef SIMD_X86
+
+/**
+ * @brief Devolve o ndice do bit a 1 menos significativo (m tem de ser diferente de 0).
+ */
+static int PrimeiroBit(unsigned int m)
+{
+#ifdef _MSC_VER
+    unsigned long i;
+    _BitScanForward(&i, m);
+    return (int)i;
+#else
+    return __builtin_ctz(m);
+#endif
+}
+
+/**
+ * @brief Verso SSE2: compara 16 caracteres de cada vez.
+ */
+ALVO_SSE2
+static const char* ProcurarSse2(const char* p, const char* fim)
+{
+    const __m128i ponto = _mm_set1_epi8('.');
+    while (fim - p >= 16) {
+        __m128i bloco = _mm_loadu_si128((const __m128i*)p);
+        unsigned int vazias = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(bloco, ponto));
+        if (vazias != 0xFFFFu) return p + PrimeiroBit(~vazias); // Encontrou uma clula ocupada
+        p += 16;
+    }
+    return ProcurarEscalar(p, fim);
+}
+
+/**
+ * @brief Verso AVX2: compara 32 caracteres de cada vez.
+ */
+ALVO_AVX2
+static const char* ProcurarAvx2(const char* p, const char* fim)
+{
+    const __m256i ponto = _mm256_set1_epi8('.');
+    while (fim - p >= 32) {
+        __m256i bloco = _mm256_loadu_si256((const __m256i*)p);
+        unsigned int vazias = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bloco, ponto));
+        if (vazias != 0xFFFFFFFFu) return p + PrimeiroBit(~vazias); // Encontrou uma clula ocupada
+        p += 32;
+    }
+    return ProcurarSse2(p, fim);
+}
+
+/**
+ * @brief Verso AVX2: calcula as reflexes de 8 pares de cada vez.
+ *
+ * O ndice do bit de cada posio, (y - 1) * numColunas + (x - 1),  calculado em 32 bits,
+ * pelo que mapas com mais de INT_MAX clulas usam a verso escalar.
+ */
+ALVO_AVX2
+static void RefletirAvx2(int ax, int ay, const int* x, const int* y, int n, MapaBits* mapa)
+{
+    if ((long long)mapa->numLinhas * mapa->numColunas > INT_MAX) {
+        RefletirEscalar(ax, ay, x, y, n, mapa);
+        return;
+    }
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i colunas = _mm256_set1_epi32(mapa->numColunas);
+    const __m256i limiteX = _mm256_set1_epi32(mapa->numColunas + 1);
+    const __m256i limiteY = _mm256_set1_epi32(mapa->numLinhas + 1);
+    const __m256i base = _mm256_set1_epi32(mapa->numColunas + 1); // Desconto de (y - 1) * numColunas + (x - 1)
+    const __m256i ax1 = _mm256_set1_epi32(ax), ay1 = _mm256_set1_epi32(ay);
+    const __m256i ax2 = _mm256_set1_epi32(2 * ax), ay2 = _mm256_set1_epi32(2 * ay);
+    unsigned int* palavras = mapa->palavras;
+    int indices[16];
+
+    int j = 0;
+    for (; j + 8 <= n; j += 8) {
+        __m256i bx = _mm256_loadu_si256((const __m256i*)(x + j));
+        __m256i by = _mm256_loadu_si256((const __m256i*)(y + j));
+
+        // Reflexes 2a - b e 2b - a
+        __m256i px = _mm256_sub_epi32(ax2, bx);
+        __m256i py = _mm256_sub_epi32(ay2, by);
+        __m256i qx = _mm256_sub_epi32(_mm256_add_epi32(bx, bx), ax1);
+        __m256i qy = _mm256_sub_epi32(_mm256_add_epi32(by, by), ay1);
+
+        // Dentro do mapa: 0 < x < numColunas + 1 e 0 < y < numLinhas + 1
+        __m256i dentroP = _mm256_and_si256(
+            _mm256_and_si256(_mm256_cmpgt_epi32(px, zero), _mm256_cmpgt_epi32(limiteX, px)),
+            _mm256_and_si256(_mm256_cmpgt_epi32(py, zero), _mm256_cmpgt_epi32(limiteY, py)));
+        __m256i dentroQ = _mm256_and_si256(
+            _mm256_and_si256(_mm256_cmpgt_epi32(qx, zero), _mm256_cmpgt_epi32(limiteX, qx)),
+            _mm256_and_si256(_mm256_cmpgt_epi32(qy, zero), _mm256_cmpgt_epi32(limiteY, qy)));
+        unsigned int mascara = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(dentroP)) |
+            (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(dentroQ)) << 8;
+        if (mascara == 0) continue; // Todas fora do mapa
+
+        __m256i bitP = _mm256_sub_epi32(_mm256_add_epi32(_mm256_mullo_epi32(py, colunas), px), base);
+        __m256i bitQ = _mm256_sub_epi32(_mm256_add_epi32(_mm256_mullo_epi32(qy, colunas), qx), base);
+        _mm256_storeu_si256((__m256i*)indices, bitP);
+        _mm256_storeu_si256((__m256i*)(indices + 8), bitQ);
+        while (mascara != 0) { // Escreve s as posies dentro do mapa
+            unsigned int bit = (unsigned int)indices[PrimeiroBit(mascara)];
+            palavras[bit / 32] |= 1u << (bit % 32);
+            mascara &= mascara - 1;
+        }
+    }
+    RefletirEscalar(ax, ay, x + j, y + j, n - j, mapa); // Restantes pares
+}
+
+/**
+ * @brief Deteta as instrues suportadas pelo processador (e pelo sistema operativo, no caso do AVX2).
+ */
+static int DetetarNivel(void)
+{
+#ifdef _MSC_VER
+    int r[4];
+    __cpuid(r, 0);
+    int maximo = r[0];
+    __cpuid(r, 1);
+    int sse2 = (r[3] >> 26) & 1;
+    int osxsave = (r[2] >> 27) & 1;
+    int avx = (r[2] >> 28) & 1;
+    if (maximo >= 7 && osxsave && avx && (_xgetbv(0) & 6) == 6) { // Registos YMM guardados pelo SO
+        __cpuidex(r, 7, 0);
+        if ((r[1] >> 5) & 1) return 2;
+    }
+    return sse2 ? 1 : 0;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return 2;
+    if (__builtin_cpu_supports("sse2")) return 1;
+    return 0;
+#endif
+}
+
+#else
+
+static int DetetarNivel(void)
+{
+    return 0;
+}
+
+#endif
+
+/**
+ * @brief Devolve o nvel de instrues vetoriais usado, escolhendo a verso na primeira chamada.
+ *
+ * @return 0 se escalar, 1 se SSE2, 2 se AVX2.
+ */
+int NivelSimd(void)
+{
+    if (nivel >= 0) return nivel;
+
+    int n = DetetarNivel();
+    procurar = ProcurarEscalar;
+    refletir = RefletirEscalar;
+#ifdef SIMD_X86
+    if (n == 2) {
+        procurar = ProcurarAvx2;
+        refletir = RefletirAvx2;
+    }
+    else if (n == 1) procurar = ProcurarSse2;
+#endif
+    nivel = n;
+    return nivel;
+}
+
+/**
+ * @brief Procura o prximo caracter diferente de '.'.
+ *
+ * @param p Ponteiro para o incio da procura.
+ * @param fim Ponteiro para o fim do contedo (exclusivo).
+ * @return Ponteiro para o caracter encontrado ou `fim` se no existir.
+ */
+const char* ProximaCelulaOcupada(const char* p, const char* fim)
+{
+    if (nivel < 0) NivelSimd();
+    return procurar(p, fim);
+}
+
+/**
+ * @brief Marca as localizaes nefastas dos pares formados pela antena a e cada uma das outras.
+ *
+ * @param ax A coordenada X da antena a.
+ * @param ay A coordenada Y da antena a.
+ * @param x As coordenadas X das outras antenas.
+ * @param y As coordenadas Y das outras antenas.
+ * @param n O nmero de outras antenas.
+ * @param mapa O mapa de bits.
+ */
+void MarcarReflexoes(int ax, int ay, const int* x, const int* y, int n, MapaBits* mapa)
+{
+    if (nivel < 0) NivelSimd();
+    refletir(ax, ay, x, y, n, mapa);
+}
\ No newline at end of file
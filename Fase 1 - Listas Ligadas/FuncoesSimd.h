@@ -0,0 +1,52 @@
+/**
+ * @file FuncoesSimd.h
+ * @brief Declarao das funes vetorizadas de leitura do mapa e de clculo dos nefastos.
+ *
+ * @details Este ficheiro contm as declaraes das funes que percorrem o contedo do mapa
+ * comparando 16 (SSE2) ou 32 (AVX2) caracteres de cada vez, para saltar rapidamente as
+ * clulas vazias ('.'), e da funo que calcula as localizaes nefastas de 8 pares de
+ * antenas de cada vez (AVX2). A verso usada  escolhida em tempo de execuo.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-03-30
+ * @version 1.0
+ */
+
+#ifndef FUNCOESSIMD_H
+#define FUNCOESSIMD_H
+
+#include "Structs.h"
+
+/**
+ * @brief Devolve o nvel de instrues vetoriais usado e faz a escolha na primeira chamada.
+ *
+ * Deve ser chamada antes de lanar threads que usem `ProximaCelulaOcupada` ou `MarcarReflexoes`.
+ *
+ * @return 0 se escalar, 1 se SSE2, 2 se AVX2.
+ */
+int NivelSimd(void);
+
+/**
+ * @brief Procura o prximo caracter diferente de '.' (antena ou quebra de linha).
+ *
+ * @param p Ponteiro para o incio da procura.
+ * @param fim Ponteiro para o fim do contedo (exclusivo).
+ * @return Ponteiro para o caracter encontrado ou `fim` se no existir.
+ */
+const char* ProximaCelulaOcupada(const char* p, const char* fim);
+
+/**
+ * @brief Marca no mapa de bits as localizaes nefastas dos pares formados por uma antena e outras n.
+ *
+ * Para cada antena b do vetor, marca as posies 2a - b e 2b - a que estejam dentro do mapa.
+ *
+ * @param ax A coordenada X da antena a.
+ * @param ay A coordenada Y da antena a.
+ * @param x As coordenadas X das outras antenas.
+ * @param y As coordenadas Y das outras antenas.
+ * @param n O nmero de outras antenas.
+ * @param mapa O mapa de bits onde as localizaes so marcadas.
+ */
+void MarcarReflexoes(int ax, int ay, const int* x, const int* y, int n, MapaBits* mapa);
+
+#endif
@@ -0,0 +1,155 @@
+/**
+ * @file FuncoesThreads.c
+ * @brief Implementao das funes de execuo paralela.
+ *
+ * @details Este ficheiro esconde as diferenas entre as threads de Windows (`CreateThread`)
+ * e as pthreads de POSIX. O resto do programa s usa `ExecutarEmParalelo`, que lana as
+ * threads, executa a tarefa e espera que todas terminem (modelo fork-join), e
+ * `SomarAtomicoInteiro`, para as threads irem buscar trabalho a uma fila partilhada.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-03-30
+ * @version 1.0
+ */
+
+#include <stdlib.h>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#include "FuncoesThreads.h"
+
+/**
+ * @brief Argumentos passados a cada thread.
+ */
+typedef struct ArgumentoThread {
+    TarefaParalela tarefa; /**< Funo a executar */
+    void* dados;           /**< Dados partilhados */
+    int indice;            /**< ndice da thread */
+    int total;             /**< Nmero total de threads */
+} ArgumentoThread;
+
+#ifdef _WIN32
+static DWORD WINAPI ArrancarThread(LPVOID arg)
+{
+    ArgumentoThread* a = (ArgumentoThread*)arg;
+    a->tarefa(a->dados, a->indice, a->total);
+    return 0;
+}
+#else
+static void* ArrancarThread(void* arg)
+{
+    ArgumentoThread* a = (ArgumentoThread*)arg;
+    a->tarefa(a->dados, a->indice, a->total);
+    return NULL;
+}
+#endif
+
+/**
+ * @brief Devolve o nmero de processadores lgicos do sistema.
+ *
+ * @return O nmero de processadores, no mnimo 1.
+ */
+int NumeroProcessadores(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+/**
+ * @brief Executa uma tarefa em vrias threads e espera que todas terminem.
+ *
+ * @param tarefa A funo a executar.
+ * @param dados Ponteiro passado a todas as threads.
+ * @param numThreads O nmero de threads (se for <= 0, usa o nmero de processadores).
+ * @return 0 em caso de sucesso, -1 se a tarefa for invlida.
+ *
+ * @details
+ * A funo cria `numThreads - 1` threads e executa ela prpria a parte 0. Se alguma thread
+ * no puder ser criada (ou faltar memria para as criar), a sua parte  executada pela
+ * thread que chama, pelo que todo o trabalho  sempre feito.
+ */
+int ExecutarEmParalelo(TarefaParalela tarefa, void* dados, int numThreads)
+{
+    if (tarefa == NULL) return -1;
+    if (numThreads <= 0) numThreads = NumeroProcessadores();
+    if (numThreads == 1) { // No h threads a lanar
+        tarefa(dados, 0, 1);
+        return 0;
+    }
+
+    ArgumentoThread* args = (ArgumentoThread*)malloc(numThreads * sizeof(ArgumentoThread));
+#ifdef _WIN32
+    HANDLE* threads = (HANDLE*)malloc(numThreads * sizeof(HANDLE));
+#else
+    pthread_t* threads = (pthread_t*)malloc(numThreads * sizeof(pthread_t));
+#endif
+    char* criada = (char*)calloc(numThreads, sizeof(char));
+    if (args == NULL || threads == NULL || criada == NULL) {
+        free(args);
+        free(threads);
+        free(criada);
+        for (int i = 0; i < numThreads; i++) tarefa(dados, i, numThreads); // Executa tudo nesta thread
+        return 0;
+    }
+
+    for (int i = 0; i < numThreads; i++) {
+        args[i].tarefa = tarefa;
+        args[i].dados = dados;
+        args[i].indice = i;
+        args[i].total = numThreads;
+    }
+    for (int i = 1; i < numThreads; i++) { // Lana as threads 1..numThreads-1
+#ifdef _WIN32
+        threads[i] = CreateThread(NULL, 0, ArrancarThread, &args[i], 0, NULL);
+        criada[i] = threads[i] != NULL;
+#else
+        criada[i] = pthread_create(&threads[i], NULL, ArrancarThread, &args[i]) == 0;
+#endif
+    }
+
+    tarefa(dados, 0, numThreads); // A thread atual executa a parte 0
+
+    for (int i = 1; i < numThreads; i++) { // Espera pelas restantes
+        if (!criada[i]) {
+            tarefa(dados, i, numThreads);
+            continue;
+        }
+#ifdef _WIN32
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+#else
+        pthread_join(threads[i], NULL);
+#endif
+    }
+
+    free(args);
+    free(threads);
+    free(criada);
+    return 0;
+}
+
+/**
+ * @brief Soma atomicamente um valor a um inteiro partilhado entre threads.
+ *
+ * @param destino Ponteiro para o inteiro.
+ * @param valor O valor a somar.
+ * @return O valor do inteiro antes da soma.
+ */
+int SomarAtomicoInteiro(volatile int* destino, int valor)
+{
+#ifdef _WIN32
+    return InterlockedExchangeAdd((volatile LONG*)destino, valor);
+#else
+    return __sync_fetch_and_add(destino, valor);
+#endif
+}
@@ -0,0 +1,54 @@
+/**
+ * @file FuncoesThreads.h
+ * @brief Declarao das funes de execuo paralela.
+ *
+ * @details Este ficheiro contm as declaraes das funes que permitem executar uma tarefa
+ * em vrias threads (Windows ou POSIX) e esperar que todas terminem.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-03-30
+ * @version 1.0
+ */
+
+#ifndef FUNCOESTHREADS_H
+#define FUNCOESTHREADS_H
+
+ /**
+  * @brief Tipo da funo executada por cada thread.
+  *
+  * @param dados Ponteiro para os dados partilhados por todas as threads.
+  * @param indiceThread ndice da thread (de 0 a numThreads - 1).
+  * @param numThreads Nmero total de threads.
+  */
+typedef void (*TarefaParalela)(void* dados, int indiceThread, int numThreads);
+
+/**
+ * @brief Devolve o nmero de processadores lgicos do sistema.
+ *
+ * @return O nmero de processadores (no mnimo 1).
+ */
+int NumeroProcessadores(void);
+
+/**
+ * @brief Executa uma tarefa em vrias threads e espera que todas terminem.
+ *
+ * A thread que chama a funo executa a parte com ndice 0. As partes que no puderem
+ * ser executadas noutra thread so executadas pela thread que chama.
+ *
+ * @param tarefa A funo a executar.
+ * @param dados Ponteiro passado a todas as threads.
+ * @param numThreads O nmero de threads (se for <= 0, usa o nmero de processadores).
+ * @return 0 em caso de sucesso, -1 se a tarefa for invlida.
+ */
+int ExecutarEmParalelo(TarefaParalela tarefa, void* dados, int numThreads);
+
+/**
+ * @brief Soma atomicamente um valor a um inteiro partilhado entre threads.
+ *
+ * @param destino Ponteiro para o inteiro.
+ * @param valor O valor a somar.
+ * @return O valor do inteiro antes da soma.
+ */
+int SomarAtomicoInteiro(volatile int* destino, int valor);
+
+#endif
@@ -49,4 +49,77 @@ typedef struct Nefasto {
     struct Nefasto* prox; /**< Ponteiro para o prximo nefasto */
 } Nefasto;
 
+/**
+ * @struct GruposFrequencia
+ * @brief Antenas agrupadas por frequncia, com as coordenadas em vetores separados.
+ *
+ * As antenas de cada frequncia ficam seguidas nos vetores `x` e `y`, pela ordem da lista,
+ * para que os pares de uma frequncia sejam percorridos sem voltar a percorrer a lista.
+ *
+ * @param inicio As antenas da frequncia f ocupam as posies inicio[f] a inicio[f + 1] - 1.
+ * @param x As coordenadas X das antenas.
+ * @param y As coordenadas Y das antenas.
+ * @param total O nmero total de antenas.
+ */
+typedef struct GruposFrequencia {
+    int inicio[257];  /**< Incio de cada frequncia (ndice = frequncia como unsigned char) */
+    int* x;           /**< Coordenadas X das antenas */
+    int* y;           /**< Coordenadas Y das antenas */
+    int total;        /**< Nmero total de antenas */
+} GruposFrequencia;
+
+/**
+ * @struct MapaBits
+ * @brief Mapa com um bit por clula, usado para marcar as localizaes com efeito nefasto.
+ *
+ * A clula (x, y), com coordenadas a comear em 1, corresponde ao bit
+ * (y - 1) * numColunas + (x - 1).
+ *
+ * @param palavras Os bits das clulas, 32 por palavra.
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ */
+typedef struct MapaBits {
+    unsigned int* palavras; /**< Bits das clulas */
+    int numLinhas;          /**< Nmero de linhas do mapa */
+    int numColunas;         /**< Nmero de colunas do mapa */
+} MapaBits;
+
+/**
+ * @struct AntenasFrequencia
+ * @brief Coordenadas das antenas de uma frequncia, num vetor que cresce conforme necessrio.
+ *
+ * @param x As coordenadas X das antenas.
+ * @param y As coordenadas Y das antenas.
+ * @param n O nmero de antenas.
+ * @param capacidade O nmero de antenas que cabem nos vetores.
+ */
+typedef struct AntenasFrequencia {
+    int* x;         /**< Coordenadas X das antenas */
+    int* y;         /**< Coordenadas Y das antenas */
+    int n;          /**< Nmero de antenas */
+    int capacidade; /**< Capacidade dos vetores */
+} AntenasFrequencia;
+
+/**
+ * @struct ConjuntoNefastos
+ * @brief Localizaes com efeito nefasto mantidas  medida que as antenas so inseridas e removidas.
+ *
+ * Cada clula guarda o nmero de pares de antenas que a tornam nefasta; a clula  nefasta
+ * enquanto esse nmero for maior do que 0.
+ *
+ * @param contagens O nmero de pares que marcam cada clula, pela mesma ordem do MapaBits.
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ * @param numNefastos O nmero de clulas com contagem maior do que 0.
+ * @param frequencias As antenas de cada frequncia (ndice = frequncia como unsigned char).
+ */
+typedef struct ConjuntoNefastos {
+    int* contagens;                         /**< Nmero de pares que marcam cada clula */
+    int numLinhas;                          /**< Nmero de linhas do mapa */
+    int numColunas;                         /**< Nmero de colunas do mapa */
+    int numNefastos;                        /**< Nmero de clulas nefastas */
+    AntenasFrequencia frequencias[256];     /**< Antenas de cada frequncia */
+} ConjuntoNefastos;
+
 #endif
\ No newline at end of file
@@ -0,0 +1,214 @@
+/**
+ * @file FuncoesVerificacao.c
+ * @brief Implementao das verificaes do clculo das localizaes nefastas.
+ *
+ * @details A referncia percorre as clulas do mapa por linha e coluna e, para cada uma,
+ * testa todos os pares de antenas da lista com a mesma frequncia, diretamente pela definio
+ * (2a - b e 2b - a, ou a reta que passa pelas duas antenas no modo harmnico). No usa os
+ * grupos de frequncia, o mapa de bits nem as contagens, pelo que no partilha erros com as
+ * verses que verifica. As localizaes saem pela mesma ordem de NefastosDoMapa.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-03-30
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Structs.h"
+#include "FuncoesAntena.h"
+#include "FuncoesNefasto.h"
+#include "FuncoesNefastoIncremental.h"
+#include "FuncoesVerificacao.h"
+
+/**
+ * @brief Imprime o resultado de uma verificao.
+ *
+ * @param descricao A descrio da verificao.
+ * @param resultado 0 (coincide), 1 (difere) ou negativo (erro).
+ * @return O prprio resultado.
+ */
+int ImprimirVerificacao(const char* descricao, int resultado)
+{
+    const char* estado = resultado == 0 ? "OK" : (resultado > 0 ? "FALHOU" : "ERRO");
+    printf("%-50s %s\n", descricao, estado);
+    return resultado;
+}
+
+/**
+ * @brief Indica se o par de antenas (a, b) torna nefasta a clula (x, y).
+ */
+static int ParNefasto(const Antena* a, const Antena* b, int x, int y, int modo)
+{
+    if (modo == NEFASTOS_HARMONICOS) { // Produto externo nulo: (x, y) est na reta de a e b
+        long long dx = (long long)b->x - a->x, dy = (long long)b->y - a->y;
+        if (dx == 0 && dy == 0) return x == a->x && y == a->y; // Antenas coincidentes: no h reta
+        return dx * ((long long)y - a->y) == dy * ((long long)x - a->x);
+    }
+    return (x == 2 * a->x - b->x && y == 2 * a->y - b->y) ||
+        (x == 2 * b->x - a->x && y == 2 * b->y - a->y);
+}
+
+/**
+ * @brief Indica se algum par de antenas da mesma frequncia torna nefasta a clula (x, y).
+ */
+static int CelulaNefasta(Antena* lista, int x, int y, int modo)
+{
+    for (Antena* a = lista; a != NULL; a = a->prox) {
+        for (Antena* b = a->prox; b != NULL; b = b->prox) {
+            if (a->frequencia == b->frequencia && ParNefasto(a, b, x, y, modo)) return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Compara as localizaes de uma verso otimizada com as da referncia.
+ *
+ * @param lista A lista de antenas.
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ * @param modo NEFASTOS_REFLEXAO ou NEFASTOS_HARMONICOS.
+ * @param nefastos O vetor devolvido pela verso otimizada (NULL se no houver nenhuma).
+ * @param numNefastos O nmero de localizaes do vetor.
+ * @return 0 se coincidem, 1 se diferem.
+ */
+static int CompararComReferencia(Antena* lista, int numLinhas, int numColunas, int modo,
+    const Nefasto* nefastos, int numNefastos)
+{
+    int k = 0;
+    for (int y = 1; y <= numLinhas; y++) {
+        for (int x = 1; x <= numColunas; x++) {
+            if (!CelulaNefasta(lista, x, y, modo)) continue;
+            if (k == numNefastos || nefastos[k].x != x || nefastos[k].y != y) return 1;
+            k++;
+        }
+    }
+    return k == numNefastos ? 0 : 1;
+}
+
+/**
+ * @brief Compara dois vetores de localizaes, pela ordem.
+ *
+ * @return 0 se so iguais, 1 caso contrrio.
+ */
+static int CompararNefastos(const Nefasto* a, int numA, const Nefasto* b, int numB)
+{
+    if (numA != numB) return 1;
+    for (int i = 0; i < numA; i++) {
+        if (a[i].x != b[i].x || a[i].y != b[i].y) return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Compara CalcularNefastos com a referncia.
+ *
+ * @param lista A lista de antenas.
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ * @param modo NEFASTOS_REFLEXAO ou NEFASTOS_HARMONICOS.
+ * @return 0 se as localizaes coincidem, 1 se diferem.
+ *
+ * @details
+ * CalcularNefastos devolve NULL tanto quando no h localizaes como quando falta memria,
+ * pelo que uma falta de memria aparece como uma diferena.
+ */
+int VerificarNefastos(Antena* lista, int numLinhas, int numColunas, int modo)
+{
+    int numNefastos = 0;
+    Nefasto* nefastos = CalcularNefastos(lista, numLinhas, numColunas, modo, &numNefastos);
+
+    int resultado = CompararComReferencia(lista, numLinhas, numColunas, modo, nefastos, numNefastos);
+    DestroiNefastos(nefastos);
+    return resultado;
+}
+
+/**
+ * @brief Compara a verso paralela com a sequencial.
+ *
+ * A verso paralela corre com um par mnimo por thread, para que use vrias threads
+ * (mapas privados, distribuio dos blocos e UnirMapas) mesmo no mapa de demonstrao.
+ *
+ * @param lista A lista de antenas.
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ * @param modo NEFASTOS_REFLEXAO ou NEFASTOS_HARMONICOS.
+ * @param numThreads O nmero de threads da verso paralela.
+ * @return 0 se as localizaes coincidem, 1 se diferem.
+ */
+int VerificarNefastosParalelo(Antena* lista, int numLinhas, int numColunas, int modo, int numThreads)
+{
+    int numSequencial = 0, numParalelo = 0;
+    Nefasto* sequencial = CalcularNefastos(lista, numLinhas, numColunas, modo, &numSequencial);
+    Nefasto* paralelo = CalcularNefastosParaleloMinimo(lista, numLinhas, numColunas, modo, &numParalelo, numThreads, 1);
+
+    int resultado = CompararNefastos(sequencial, numSequencial, paralelo, numParalelo);
+    DestroiNefastos(sequencial);
+    DestroiNefastos(paralelo);
+    return resultado;
+}
+
+/**
+ * @brief Compara as localizaes do conjunto com as de CalcularNefastos sobre a lista.
+ *
+ * @return 0 se coincidem, 1 se diferem.
+ */
+static int CompararConjunto(const ConjuntoNefastos* conjunto, Antena* lista, int numLinhas, int numColunas)
+{
+    int numConjunto = 0, numCalculados = 0;
+    Nefasto* doConjunto = NefastosDoConjunto(conjunto, &numConjunto);
+    Nefasto* calculados = CalcularNefastos(lista, numLinhas, numColunas, NEFASTOS_REFLEXAO, &numCalculados);
+
+    int resultado = CompararNefastos(doConjunto, numConjunto, calculados, numCalculados);
+    DestroiNefastos(doConjunto);
+    DestroiNefastos(calculados);
+    return resultado;
+}
+
+/**
+ * @brief Compara o conjunto incremental com o clculo completo depois de cada alterao.
+ *
+ * @param lista A lista de antenas.
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ * @return 0 se coincidem, 1 se diferem, -1 se faltar memria.
+ */
+int VerificarNefastosIncremental(Antena* lista, int numLinhas, int numColunas)
+{
+    // Cpia da lista, para no alterar a do chamador (a ordem no altera as localizaes)
+    Antena* copia = NULL;
+    for (Antena* a = lista; a != NULL; a = a->prox) {
+        Antena* nova = InserirAntenaInicio(copia, a->frequencia, a->x, a->y);
+        if (nova == copia) {
+            DestroiLista(copia);
+            return -1;
+        }
+        copia = nova;
+    }
+
+    ConjuntoNefastos conjunto;
+    if (CriarConjuntoNefastos(&conjunto, copia, numLinhas, numColunas) != 0) {
+        DestroiLista(copia);
+        return -1;
+    }
+
+    int resultado = CompararConjunto(&conjunto, copia, numLinhas, numColunas);
+    for (Antena* a = lista; a != NULL && resultado == 0; a = a->prox) {
+        Antena* nova = InserirAntenaNefastos(copia, &conjunto, a->frequencia, numColunas + 1 - a->x, numLinhas + 1 - a->y);
+        if (nova == copia) resultado = -1;
+        else {
+            copia = nova;
+            resultado = CompararConjunto(&conjunto, copia, numLinhas, numColunas);
+        }
+    }
+    for (Antena* a = lista; a != NULL && resultado == 0; a = a->prox) {
+        int removida;
+        copia = RemoverAntenaNefastos(copia, &conjunto, numColunas + 1 - a->x, numLinhas + 1 - a->y, &removida);
+        resultado = removida != 0 ? 1 : CompararConjunto(&conjunto, copia, numLinhas, numColunas);
+    }
+
+    LibertarConjuntoNefastos(&conjunto);
+    DestroiLista(copia);
+    return resultado;
+}
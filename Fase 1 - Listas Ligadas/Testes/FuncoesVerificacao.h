@@ -0,0 +1,69 @@
+/**
+ * @file FuncoesVerificacao.h
+ * @brief Declarao das funes que comparam o clculo das localizaes nefastas com uma referncia.
+ *
+ * @details Cada verificao calcula as localizaes com uma das verses otimizadas e com uma
+ * verso simples, e compara as duas listas. A referncia testa todos os pares de antenas em
+ * cada clula do mapa, pelo que se destina a mapas pequenos e s faz parte do programa de
+ * testes (Testes/main.c), nunca do programa principal.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-03-30
+ * @version 1.0
+ */
+
+#ifndef FUNCOESVERIFICACAO_H
+#define FUNCOESVERIFICACAO_H
+
+#include "Structs.h"
+
+ /**
+  * @brief Imprime o resultado de uma verificao numa linha ("OK", "FALHOU" ou "ERRO").
+  *
+  * @param descricao A descrio da verificao.
+  * @param resultado O valor devolvido pela verificao.
+  * @return O prprio resultado, para que quem chama possa contar as falhas.
+  */
+int ImprimirVerificacao(const char* descricao, int resultado);
+
+/**
+ * @brief Compara CalcularNefastos com a referncia.
+ *
+ * @param lista A lista de antenas.
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ * @param modo NEFASTOS_REFLEXAO ou NEFASTOS_HARMONICOS.
+ * @return 0 se as localizaes coincidem, 1 se diferem (tambm se faltar memria).
+ */
+int VerificarNefastos(Antena* lista, int numLinhas, int numColunas, int modo);
+
+/**
+ * @brief Compara CalcularNefastosParalelo com CalcularNefastos.
+ *
+ * As duas verses tm de devolver as mesmas localizaes, pela mesma ordem. A verso
+ * paralela usa `numThreads` threads sempre que houver pelo menos um par por thread.
+ *
+ * @param lista A lista de antenas.
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ * @param modo NEFASTOS_REFLEXAO ou NEFASTOS_HARMONICOS.
+ * @param numThreads O nmero de threads da verso paralela.
+ * @return 0 se as localizaes coincidem, 1 se diferem (tambm se faltar memria).
+ */
+int VerificarNefastosParalelo(Antena* lista, int numLinhas, int numColunas, int modo, int numThreads);
+
+/**
+ * @brief Compara o conjunto incremental com CalcularNefastos ao longo de inseres e remoes.
+ *
+ * Trabalha sobre uma cpia da lista: para cada antena insere outra da mesma frequncia na
+ * posio simtrica do mapa e depois remove-as pela mesma ordem. Depois de cada alterao,
+ * o conjunto tem de dar as mesmas localizaes que CalcularNefastos sobre a cpia.
+ *
+ * @param lista A lista de antenas (no  alterada).
+ * @param numLinhas O nmero de linhas do mapa.
+ * @param numColunas O nmero de colunas do mapa.
+ * @return 0 se as localizaes coincidem sempre, 1 se diferem, -1 se faltar memria.
+ */
+int VerificarNefastosIncremental(Antena* lista, int numLinhas, int numColunas);
+
+#endif
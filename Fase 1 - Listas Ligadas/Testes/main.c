@@ -0,0 +1,66 @@
+/**
+ * @file main.c
+ * @brief Programa de testes: compara o clculo das localizaes nefastas com a referncia.
+ *
+ * @details L o mapa do programa principal (ou o indicado como argumento) e corre as
+ * verificaes de FuncoesVerificacao.h sobre a lista de antenas. A referncia testa todos
+ * os pares de antenas em cada clula, pelo que o mapa deve ser pequeno.
+ *
+ * O programa termina com 0 se todas as verificaes passarem e com 1 caso contrrio.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-03-30
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <locale.h>
+#include "FuncoesAntena.h"
+#include "FuncoesFicheiro.h"
+#include "FuncoesNefasto.h"
+#include "FuncoesVerificacao.h"
+#include "Structs.h"
+
+#define MAPA_POR_OMISSAO "../mapa_antenas.txt"   // Relativo  pasta Testes
+
+int main(int argc, char* argv[])
+{
+    setlocale(LC_ALL, "Portuguese");
+
+    char* nomeMapa = argc > 1 ? argv[1] : MAPA_POR_OMISSAO;
+    int numLinhas = 0, numColunas = 0;
+    Antena* listaAntenas = LerFicheiro(nomeMapa, NULL, &numLinhas, &numColunas);
+    if (listaAntenas == NULL) {
+        printf("No foi possvel ler antenas do mapa \"%s\".\n", nomeMapa);
+        return 1;
+    }
+
+    int falhas = 0;
+    printf("Verificaes:\n");
+    falhas += ImprimirVerificacao("Nefastos (reflexo) vs referncia",
+        VerificarNefastos(listaAntenas, numLinhas, numColunas, NEFASTOS_REFLEXAO)) != 0;
+    falhas += ImprimirVerificacao("Nefastos (harmnicos) vs referncia",
+        VerificarNefastos(listaAntenas, numLinhas, numColunas, NEFASTOS_HARMONICOS)) != 0;
+    falhas += ImprimirVerificacao("Nefastos paralelo vs sequencial",
+        VerificarNefastosParalelo(listaAntenas, numLinhas, numColunas, NEFASTOS_REFLEXAO, 4)) != 0;
+    falhas += ImprimirVerificacao("Nefastos paralelo (harmnicos) vs sequencial",
+        VerificarNefastosParalelo(listaAntenas, numLinhas, numColunas, NEFASTOS_HARMONICOS, 4)) != 0;
+    falhas += ImprimirVerificacao("Nefastos incremental vs CalcularNefastos",
+        VerificarNefastosIncremental(listaAntenas, numLinhas, numColunas)) != 0;
+
+    // Duas antenas da mesma frequncia na mesma clula, mais uma alinhada e outra fora da reta
+    Antena* coincidentes = NULL;
+    coincidentes = InserirAntenaFim(coincidentes, 'A', 3, 3);
+    coincidentes = InserirAntenaFim(coincidentes, 'A', 3, 3);
+    coincidentes = InserirAntenaFim(coincidentes, 'A', 5, 5);
+    coincidentes = InserirAntenaFim(coincidentes, 'A', 2, 6);
+    falhas += ImprimirVerificacao("Nefastos (reflexo), antenas coincidentes",
+        VerificarNefastos(coincidentes, 8, 8, NEFASTOS_REFLEXAO)) != 0;
+    falhas += ImprimirVerificacao("Nefastos (harmnicos), antenas coincidentes",
+        VerificarNefastos(coincidentes, 8, 8, NEFASTOS_HARMONICOS)) != 0;
+    DestroiLista(coincidentes);
+
+    DestroiLista(listaAntenas);
+    return falhas > 0 ? 1 : 0;
+}
@@ -16,6 +16,7 @@
 #include <locale.h> 
 #include "FuncoesAntena.h"
 #include "FuncoesFicheiro.h"
+#include "FuncoesNefasto.h"
 #include "Structs.h"
 
 int main()
@@ -64,6 +65,18 @@ int main()
     printf("\nLista de Antenas aps a remoo:\n");
     ListarAntenas(listaAntenas);
 
+    // Calcular e listar as localizaes com efeito nefasto
+    printf("\nLocalizaes com efeito nefasto:\n");
+    Nefasto* nefastos = CalcularNefastos(listaAntenas, numLinhas, numColunas, NEFASTOS_REFLEXAO, NULL);
+    ListarNefastos(nefastos);
+    nefastos = DestroiNefastos(nefastos);
+
+    // As mesmas, no modo harmnico (todas as clulas da reta de cada par)
+    printf("\nLocalizaes com efeito nefasto (harmnicos):\n");
+    nefastos = CalcularNefastos(listaAntenas, numLinhas, numColunas, NEFASTOS_HARMONICOS, NULL);
+    ListarNefastos(nefastos);
+    nefastos = DestroiNefastos(nefastos);
+
     // Libertar memria das listas
     DestroiLista(listaAntenas);
 
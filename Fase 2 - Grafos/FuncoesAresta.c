@@ -17,6 +17,13 @@
 #include "FuncoesAresta.h"
 #include "Structs.h"
 #include "FuncoesVertice.h"
+#include "FuncoesMemoria.h"
+#include "FuncoesComponentes.h"
+#include "FuncoesThreads.h"
+
+// as 8 direes: primeiro as ortogonais (peso 1.0), depois as diagonais (peso 1.414)
+static const int dx[] = { 0, 0, -1, 1, -1, 1, -1, 1 };
+static const int dy[] = { -1, 1, 0, 0, -1, -1, 1, 1 };
 
  /**
   * @brief Adiciona uma aresta entre dois vrtices com um determinado peso.
@@ -25,6 +32,7 @@
   * atribuindo-lhe um peso especificado. A aresta  adicionada ao incio da lista de adjacncia
   * do vrtice de origem.
   *
+  * @param grafo Apontador para o grafo a que os vrtices pertencem.
   * @param origem Apontador para o vrtice de origem.
   * @param destino Apontador para o vrtice de destino.
   * @param peso Peso associado  aresta (normalmente distncia ou custo).
@@ -32,13 +40,13 @@
   *         -2 se falhar a alocao de memria.
   *
   * @details
-  * A funo aloca dinamicamente uma nova estrutura `Aresta`. Se a alocao for bem-sucedida,
+  * A funo obtm uma nova estrutura `Aresta` do pool de arestas do grafo. Se a alocao for bem-sucedida,
   * inicializa os campos `destino`, `peso` e insere a aresta no incio da lista de adjacncia do vrtice origem.
   */
-int adicionarAresta(Vertice* origem, Vertice* destino, float peso) {
-    if (!origem || !destino) return -1;  // erro: parmetros invlidos
+int adicionarAresta(GR* grafo, Vertice* origem, Vertice* destino, float peso) {
+    if (!grafo || !origem || !destino) return -1;  // erro: parmetros invlidos
 
-    Aresta* novaAresta = malloc(sizeof(Aresta));
+    Aresta* novaAresta = alocarDoPool(&grafo->poolArestas);
     if (!novaAresta) {
         return -2;  // erro: sem memria
     }
@@ -47,10 +55,110 @@ int adicionarAresta(Vertice* origem, Vertice* destino, float peso) {
     novaAresta->peso = peso;
     novaAresta->next = origem->adj;
     origem->adj = novaAresta;
+    unirComponentes(grafo, origem, destino);
+    grafo->versao++;
 
     return 0;  // sucesso
 }
 
+/**
+ * @brief Procura a aresta que liga dois vrtices.
+ *
+ * @param origem Apontador para o vrtice de origem.
+ * @param destino Apontador para o vrtice de destino.
+ * @return Apontador para a primeira aresta de `origem` para `destino`, ou NULL se no existir.
+ */
+Aresta* procurarAresta(Vertice* origem, Vertice* destino) {
+    if (!origem || !destino) return NULL;
+
+    for (Aresta* a = origem->adj; a != NULL; a = a->next) {
+        if (a->destino == destino) return a;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Remove as arestas de um vrtice para outro, devolvendo-as ao pool.
+ *
+ * S percorre a lista de adjacncia de `origem`, ao contrrio de
+ * `removerArestasParaVertice`, que percorre o grafo inteiro.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param origem Apontador para o vrtice de origem.
+ * @param destino Apontador para o vrtice de destino.
+ * @return 0 se sucesso, -1 se os parmetros forem invlidos.
+ */
+int removerAresta(GR* grafo, Vertice* origem, Vertice* destino) {
+    if (!grafo || !origem || !destino) return -1;
+
+    Aresta** ligacao = &origem->adj;
+    while (*ligacao) {
+        Aresta* a = *ligacao;
+        if (a->destino == destino) {
+            *ligacao = a->next;
+            devolverAoPool(&grafo->poolArestas, a);
+            invalidarComponentes(grafo);
+            grafo->versao++;
+        }
+        else {
+            ligacao = &a->next;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Liga um vrtice aos vizinhos adjacentes com a mesma frequncia, nos dois sentidos.
+ *
+ * Consulta apenas as 8 posies  volta do vrtice, pelo que o custo no depende do
+ * tamanho do grafo. Pares que j estejam ligados no so duplicados.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice (j adicionado ao grafo).
+ * @return 0 se sucesso, -1 se os parmetros forem invlidos, -2 se falhar a alocao de memria.
+ */
+int ligarVizinhosAdjacentes(GR* grafo, Vertice* v) {
+    if (!grafo || !v) return -1;
+
+    for (int i = 0; i < 8; i++) {
+        Vertice* vizinho = procurarVerticePorCoordenadas(grafo, v->x + dx[i], v->y + dy[i]);
+        if (vizinho && vizinho->frequencia == v->frequencia && !procurarAresta(v, vizinho)) {
+            float peso = (i < 4) ? 1.0f : 1.414f;
+            if (adicionarAresta(grafo, v, vizinho, peso) != 0) return -2;
+            if (adicionarAresta(grafo, vizinho, v, peso) != 0) {
+                removerAresta(grafo, v, vizinho);  // no deixar a ligao s num sentido
+                return -2;
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Remove todas as ligaes de um vrtice, nos dois sentidos.
+ *
+ * Para cada aresta v -> w remove a aresta de volta w -> v percorrendo s a lista de
+ * adjacncia de w, pelo que o custo depende apenas do nmero de vizinhos.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return 0 se sucesso, -1 se os parmetros forem invlidos.
+ *
+ * @note Assume que as arestas so simtricas, como as criadas por `criarArestasAdjacentes`,
+ * `criarArestasAdjacentesPorLinhas` e `ligarVizinhosAdjacentes`. Uma aresta w -> v sem a
+ * aresta v -> w correspondente no  removida; nesse caso deve usar-se `removerArestasParaVertice`.
+ */
+int desligarVizinhos(GR* grafo, Vertice* v) {
+    if (!grafo || !v) return -1;
+
+    for (Aresta* a = v->adj; a != NULL; a = a->next) {
+        if (a->destino != v) {
+            removerAresta(grafo, a->destino, v);
+        }
+    }
+    return libertarArestasDoVertice(grafo, v);
+}
+
 /**
  * @brief Cria arestas adjacentes entre vrtices do grafo com base nas suas posies e frequncias.
  *
@@ -63,14 +171,13 @@ int adicionarAresta(Vertice* origem, Vertice* destino, float peso) {
  *
  * @details
  * Para evitar duplicao de arestas, apenas cria-se uma ligao se o ID do destino for maior
- * que o do vrtice origem. Usa a funo `adicionarAresta` para inserir as arestas.
+ * que o do vrtice origem e se os dois vrtices ainda no estiverem ligados (a funo pode
+ * ser chamada de novo depois de acrescentar vrtices). Usa a funo `adicionarAresta` para
+ * inserir as arestas. No fim, as componentes ligadas do grafo ficam calculadas.
  */
 int criarArestasAdjacentes(GR* grafo) {
     if (!grafo) return -1;
 
-    int dx[] = { 0, 0, -1, 1, -1, 1, -1, 1 };
-    int dy[] = { -1, 1, 0, 0, -1, -1, 1, 1 };
-
     for (Vertice* v = grafo->vertices; v != NULL; v = v->next) {
         for (int i = 0; i < 8; i++) {
             int nx = v->x + dx[i];
@@ -80,21 +187,328 @@ int criarArestasAdjacentes(GR* grafo) {
                 float peso = (i < 4) ? 1.0f : 1.414f; // distncia ortogonal ou diagonal
 
                 // Evitar duplicar arestas (exemplo: s criar se destino id > origem id)
-                if (vizinho->id > v->id) {
-                    if (adicionarAresta(v, vizinho, peso) != 0) return -2;
-                    if (adicionarAresta(vizinho, v, peso) != 0) return -2;
+                if (vizinho->id > v->id && !procurarAresta(v, vizinho)) {
+                    if (adicionarAresta(grafo, v, vizinho, peso) != 0) return -2;
+                    if (adicionarAresta(grafo, vizinho, v, peso) != 0) return -2;
                 }
             }
         }
     }
+    if (!grafo->componentes.valida) {
+        construirComponentes(grafo);  // se faltar memria, fica para a primeira consulta
+    }
     return 0; // sucesso
 }
 
+/**
+ * @brief Vrtices do grafo agrupados por linha do mapa, cada linha ordenada por coluna.
+ */
+typedef struct LinhasDoMapa {
+    Vertice** ordem;     /**< Vrtices ordenados por (y, x) */
+    int* inicio;         /**< Incio de cada linha em `ordem` (numLinhas + 1 posies) */
+    int numLinhas;       /**< Nmero de linhas com vrtices */
+} LinhasDoMapa;
+
+/**
+ * @brief Destino das arestas geradas: s contagem, escrita num vetor contguo ou no pool.
+ *
+ * Se `vetor` e `grafo` forem NULL, apenas conta; se `vetor` existir, escreve as arestas
+ * a partir de `vetor[proxima]`; caso contrrio usa `adicionarAresta`.
+ */
+typedef struct SaidaArestas {
+    GR* grafo;           /**< Grafo, para arestas obtidas uma a uma do pool */
+    Aresta* vetor;       /**< Vetor de arestas pr-alocado */
+    size_t proxima;      /**< Prxima posio livre (ou nmero de arestas contadas) */
+    int erro;            /**< Diferente de 0 se faltou memria */
+} SaidaArestas;
+
+/**
+ * @brief Faixa de linhas tratada por uma thread.
+ */
+typedef struct FaixaArestas {
+    int linhaInicio;     /**< Primeira linha da faixa */
+    int linhaFim;        /**< Linha seguinte  ltima da faixa */
+    SaidaArestas saida;  /**< Arestas da faixa */
+} FaixaArestas;
+
+/**
+ * @brief Estado partilhado pelas threads da construo de arestas.
+ */
+typedef struct ConstrucaoArestas {
+    const LinhasDoMapa* linhas;  /**< Vrtices por linha */
+    FaixaArestas* faixas;        /**< Uma faixa por thread */
+} ConstrucaoArestas;
+
+#define VERTICES_MINIMOS_POR_FAIXA (1 << 14)
+
+static int compararPorLinha(const void* a, const void* b) {
+    const Vertice* va = *(Vertice* const*)a;
+    const Vertice* vb = *(Vertice* const*)b;
+    if (va->y != vb->y) return va->y < vb->y ? -1 : 1;
+    return (va->x > vb->x) - (va->x < vb->x);
+}
+
+static int compararPorColuna(const void* a, const void* b) {
+    const Vertice* va = *(Vertice* const*)a;
+    const Vertice* vb = *(Vertice* const*)b;
+    return (va->x > vb->x) - (va->x < vb->x);
+}
+
+/**
+ * @brief Agrupa os vrtices por linha, ordenados por coluna dentro de cada linha.
+ *
+ * Quando as linhas ocupam um intervalo pequeno (o caso normal de um mapa lido de
+ * ficheiro), usa ordenao por contagem, que  linear; dentro de cada linha os vrtices
+ * do ficheiro j vm por ordem de coluna e s as linhas desordenadas (por exemplo, com
+ * vrtices acrescentados  mo) so ordenadas. Caso contrrio, usa `qsort`.
+ *
+ * @return 0 se sucesso, -2 se faltar memria.
+ */
+static int agruparPorLinha(GR* grafo, LinhasDoMapa* l) {
+    int n = grafo->numVertices;
+    l->ordem = malloc(((size_t)n + 1) * sizeof(Vertice*));
+    l->inicio = malloc(((size_t)n + 1) * sizeof(int));
+    l->numLinhas = 0;
+    if (!l->ordem || !l->inicio) return -2;
+    if (n == 0) {
+        l->inicio[0] = 0;
+        return 0;
+    }
+
+    int minY = grafo->vertices->y, maxY = minY;
+    for (Vertice* v = grafo->vertices; v != NULL; v = v->next) {
+        if (v->y < minY) minY = v->y;
+        if (v->y > maxY) maxY = v->y;
+    }
+
+    long long intervalo = (long long)maxY - minY + 1;
+    if (intervalo <= 4LL * n + 1024) {
+        int* contagem = calloc((size_t)intervalo + 1, sizeof(int));
+        if (!contagem) return -2;
+        for (Vertice* v = grafo->vertices; v != NULL; v = v->next) {
+            contagem[v->y - minY + 1]++;
+        }
+        for (long long i = 1; i <= intervalo; i++) {
+            contagem[i] += contagem[i - 1];
+        }
+        for (Vertice* v = grafo->vertices; v != NULL; v = v->next) {
+            l->ordem[contagem[v->y - minY]++] = v;  // estvel: mantm a ordem da lista
+        }
+        free(contagem);
+    }
+    else {
+        int i = 0;
+        for (Vertice* v = grafo->vertices; v != NULL; v = v->next) {
+            l->ordem[i++] = v;
+        }
+        qsort(l->ordem, (size_t)n, sizeof(Vertice*), compararPorLinha);
+    }
+
+    // delimitar as linhas e ordenar por coluna as que ainda no estiverem ordenadas
+    int i = 0;
+    while (i < n) {
+        int j = i + 1, ordenada = 1;
+        while (j < n && l->ordem[j]->y == l->ordem[i]->y) {
+            if (l->ordem[j]->x < l->ordem[j - 1]->x) ordenada = 0;
+            j++;
+        }
+        if (!ordenada) {
+            qsort(l->ordem + i, (size_t)(j - i), sizeof(Vertice*), compararPorColuna);
+        }
+        l->inicio[l->numLinhas++] = i;
+        i = j;
+    }
+    l->inicio[l->numLinhas] = n;
+    return 0;
+}
+
+/**
+ * @brief Gera as duas arestas entre `v` e `w`, conforme o destino indicado em `s`.
+ */
+static void emitirPar(SaidaArestas* s, Vertice* v, Vertice* w, float peso) {
+    if (s->vetor) {
+        Aresta* a = &s->vetor[s->proxima];
+        a[0].destino = w;
+        a[0].peso = peso;
+        a[0].next = v->adj;
+        v->adj = &a[0];
+        a[1].destino = v;
+        a[1].peso = peso;
+        a[1].next = w->adj;
+        w->adj = &a[1];
+    }
+    else if (s->grafo) {
+        if (adicionarAresta(s->grafo, v, w, peso) != 0 ||
+            adicionarAresta(s->grafo, w, v, peso) != 0) {
+            s->erro = 1;
+        }
+    }
+    s->proxima += 2;
+}
+
+/**
+ * @brief Liga os vrtices da linha `r` aos seus vizinhos a E (na mesma linha) e,
+ * se `comSeguinte`, aos vizinhos a SW, S e SE (na linha seguinte).
+ *
+ * Como as duas linhas esto ordenadas por coluna, os vizinhos de baixo so encontrados
+ * com um segundo cursor que s avana, pelo que cada linha  percorrida uma vez.
+ */
+static void ligarLinha(const LinhasDoMapa* l, int r, int comMesma, int comSeguinte, SaidaArestas* s) {
+    Vertice** linha = l->ordem + l->inicio[r];
+    int n = l->inicio[r + 1] - l->inicio[r];
+
+    if (comMesma) {
+        for (int i = 0; i + 1 < n; i++) {
+            Vertice* v = linha[i];
+            Vertice* e = linha[i + 1];
+            if (e->x == v->x + 1 && e->frequencia == v->frequencia) {
+                emitirPar(s, v, e, 1.0f);
+            }
+        }
+    }
+
+    if (!comSeguinte || r + 1 >= l->numLinhas) return;
+    Vertice** baixo = l->ordem + l->inicio[r + 1];
+    int m = l->inicio[r + 2] - l->inicio[r + 1];
+    if (m == 0 || baixo[0]->y != linha[0]->y + 1) return;  // a linha seguinte no  adjacente
+
+    int j = 0;
+    for (int i = 0; i < n; i++) {
+        Vertice* v = linha[i];
+        while (j < m && baixo[j]->x < v->x - 1) j++;
+        for (int k = j; k < m && baixo[k]->x <= v->x + 1; k++) {
+            if (baixo[k]->frequencia == v->frequencia) {
+                emitirPar(s, v, baixo[k], baixo[k]->x == v->x ? 1.0f : 1.414f);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Percorre as linhas de uma faixa (executada por cada thread).
+ *
+ * Os pares entre a ltima linha da faixa e a primeira da faixa seguinte ficam de fora,
+ * porque a aresta de volta pertenceria a um vrtice de outra thread; so ligados no fim,
+ * sem threads.
+ */
+static void percorrerFaixa(void* dados, int indiceThread, int numThreads) {
+    (void)numThreads;
+    ConstrucaoArestas* c = dados;
+    FaixaArestas* f = &c->faixas[indiceThread];
+    for (int r = f->linhaInicio; r < f->linhaFim; r++) {
+        ligarLinha(c->linhas, r, 1, r + 1 < f->linhaFim, &f->saida);
+    }
+}
+
+/**
+ * @brief Cria as arestas entre antenas adjacentes com a mesma frequncia, linha a linha.
+ *
+ * Produz as mesmas arestas que `criarArestasAdjacentes` (pesos 1.0 e 1.414), mas sem
+ * consultar a tabela de coordenadas: os vrtices so agrupados por linha e ordenados por
+ * coluna, e cada linha  comparada apenas consigo prpria (vizinho E) e com a linha
+ * seguinte (vizinhos SW, S e SE). Cada par  visto uma nica vez e gera logo as duas
+ * arestas, pelo que no  preciso comparar IDs para evitar duplicados.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param numThreads Nmero de threads (se <= 0, usa o nmero de processadores).
+ * @return 0 se sucesso, -1 se o grafo for invlido, -2 se falhar a alocao de memria.
+ *
+ * @details
+ * As arestas existentes so descartadas antes, pelo que a funo pode ser chamada de
+ * novo depois de alterar o grafo. O trabalho  feito em duas passagens por faixas de
+ * linhas, em paralelo: a primeira conta as arestas de cada faixa e a segunda escreve-as
+ * num nico vetor contguo do pool, em posies calculadas por somas prefixas. S os
+ * pares na fronteira entre faixas so ligados depois, um a um.
+ */
+int criarArestasAdjacentesPorLinhas(GR* grafo, int numThreads) {
+    if (!grafo) return -1;
+
+    for (Vertice* v = grafo->vertices; v != NULL; v = v->next) {
+        libertarArestasDoVertice(grafo, v);
+    }
+
+    LinhasDoMapa l;
+    if (agruparPorLinha(grafo, &l) != 0) {
+        free(l.ordem);
+        free(l.inicio);
+        return -2;
+    }
+
+    if (numThreads <= 0) numThreads = numeroProcessadores();
+    if (numThreads > grafo->numVertices / VERTICES_MINIMOS_POR_FAIXA) {
+        numThreads = grafo->numVertices / VERTICES_MINIMOS_POR_FAIXA;  // faixas pequenas no compensam
+    }
+    if (numThreads < 1) numThreads = 1;
+
+    ConstrucaoArestas c;
+    c.linhas = &l;
+    c.faixas = calloc((size_t)numThreads, sizeof(FaixaArestas));
+    if (!c.faixas) {
+        free(l.ordem);
+        free(l.inicio);
+        return -2;
+    }
+
+    // faixas com aproximadamente o mesmo nmero de vrtices
+    int r = 0;
+    for (int t = 0; t < numThreads; t++) {
+        long long alvo = (long long)grafo->numVertices * (t + 1) / numThreads;
+        c.faixas[t].linhaInicio = r;
+        while (r < l.numLinhas && (t + 1 == numThreads || l.inicio[r] < alvo)) r++;
+        c.faixas[t].linhaFim = r;
+    }
+
+    // primeira passagem: contar; segunda: escrever no vetor contguo
+    executarEmParalelo(percorrerFaixa, &c, numThreads);
+    size_t total = 0;
+    for (int t = 0; t < numThreads; t++) {
+        size_t n = c.faixas[t].saida.proxima;
+        c.faixas[t].saida.proxima = total;
+        total += n;
+    }
+
+    int resultado = 0;
+    if (total > 0) {
+        Aresta* vetor = alocarVetorDoPool(&grafo->poolArestas, total);
+        if (!vetor) {
+            resultado = -2;
+        }
+        else {
+            for (int t = 0; t < numThreads; t++) {
+                c.faixas[t].saida.vetor = vetor;
+            }
+            executarEmParalelo(percorrerFaixa, &c, numThreads);
+        }
+    }
+
+    // pares entre faixas vizinhas
+    SaidaArestas fronteira = { grafo, NULL, 0, 0 };
+    for (int t = 0; t + 1 < numThreads && resultado == 0; t++) {
+        FaixaArestas* f = &c.faixas[t];
+        if (f->linhaFim > f->linhaInicio && f->linhaFim < l.numLinhas) {  // faixas vazias no tm fronteira
+            ligarLinha(&l, f->linhaFim - 1, 0, 1, &fronteira);
+        }
+    }
+    if (fronteira.erro) resultado = -2;
+    grafo->versao++;  // mesmo em caso de erro, parte das arestas pode j estar ligada
+    if (resultado == 0) {
+        construirComponentes(grafo);  // as arestas do vetor contguo no passam por adicionarAresta
+    }
+    else {
+        invalidarComponentes(grafo);  // as arestas j ligadas no esto nas componentes
+    }
+
+    free(c.faixas);
+    free(l.ordem);
+    free(l.inicio);
+    return resultado;
+}
+
 /**
  * @brief Remove todas as arestas do grafo que apontam para um vrtice especfico.
  *
  * Esta funo percorre todos os vrtices do grafo e remove todas as arestas que tenham
- * o vrtice alvo como destino, libertando a memria associada a essas arestas.
+ * o vrtice alvo como destino, devolvendo essas arestas ao pool do grafo.
  *
  * @param grafo Apontador para o grafo.
  * @param alvo Apontador para o vrtice alvo cujas arestas devem ser removidas.
@@ -102,7 +516,7 @@ int criarArestasAdjacentes(GR* grafo) {
  *
  * @details
  * A funo atualiza as listas de adjacncia dos vrtices para remover todas as arestas
- * que apontem para o vrtice `alvo`, garantindo que a memria  devidamente libertada.
+ * que apontem para o vrtice `alvo`, garantindo que a memria  devolvida ao pool para ser reutilizada.
  */
 int removerArestasParaVertice(GR* grafo, Vertice* alvo) {
     if (!grafo || !alvo) return -1;
@@ -122,7 +536,9 @@ int removerArestasParaVertice(GR* grafo, Vertice* alvo) {
                 }
                 Aresta* tmp = atual;
                 atual = atual->next;
-                free(tmp);
+                devolverAoPool(&grafo->poolArestas, tmp);
+                invalidarComponentes(grafo);
+                grafo->versao++;
             }
             else {
                 anterior = atual;
@@ -137,20 +553,25 @@ int removerArestasParaVertice(GR* grafo, Vertice* alvo) {
 /**
  * @brief Liberta todas as arestas associadas a um vrtice.
  *
- * Esta funo remove e liberta da memria todas as arestas da lista de adjacncia
- * de um vrtice especfico, deixando o vrtice sem nenhuma ligao.
+ * Esta funo remove todas as arestas da lista de adjacncia de um vrtice especfico,
+ * devolvendo-as ao pool do grafo e deixando o vrtice sem nenhuma ligao.
  *
+ * @param grafo Apontador para o grafo a que o vrtice pertence.
  * @param v Apontador para o vrtice cujas arestas sero libertadas.
- * @return 0 se a operao for bem-sucedida, -1 se o vrtice for invlido.
+ * @return 0 se a operao for bem-sucedida, -1 se os parmetros forem invlidos.
  */
-int libertarArestasDoVertice(Vertice* v) {
-    if (!v) return -1;
+int libertarArestasDoVertice(GR* grafo, Vertice* v) {
+    if (!grafo || !v) return -1;
+    if (v->adj) {
+        invalidarComponentes(grafo);
+        grafo->versao++;
+    }
 
     Aresta* a = v->adj;
     while (a) {
         Aresta* tmp = a;
         a = a->next;
-        free(tmp);
+        devolverAoPool(&grafo->poolArestas, tmp);
     }
     v->adj = NULL;
     return 0;
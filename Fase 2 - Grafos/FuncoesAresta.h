@@ -16,22 +16,78 @@
 
  /**
   * @brief Adiciona uma aresta entre dois vrtices com um peso definido.
+  * A memria da aresta vem do pool de arestas do grafo.
   *
+  * @param grafo Apontador para o grafo a que os vrtices pertencem.
   * @param origem Apontador para o vrtice de origem.
   * @param destino Apontador para o vrtice de destino.
   * @param peso Peso da aresta (por exemplo, distncia ou custo).
   * @return int 0 se sucesso, valor negativo em caso de erro.
   */
-int adicionarAresta(Vertice* origem, Vertice* destino, float peso);
+int adicionarAresta(GR* grafo, Vertice* origem, Vertice* destino, float peso);
+
+/**
+ * @brief Procura a aresta de um vrtice para outro.
+ *
+ * @param origem Apontador para o vrtice de origem.
+ * @param destino Apontador para o vrtice de destino.
+ * @return Apontador para a aresta, ou NULL se no existir.
+ */
+Aresta* procurarAresta(Vertice* origem, Vertice* destino);
+
+/**
+ * @brief Remove as arestas de um vrtice para outro.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param origem Apontador para o vrtice de origem.
+ * @param destino Apontador para o vrtice de destino.
+ * @return int 0 se sucesso, valor negativo em caso de erro.
+ */
+int removerAresta(GR* grafo, Vertice* origem, Vertice* destino);
+
+/**
+ * @brief Liga um vrtice, nos dois sentidos, aos vizinhos adjacentes com a mesma frequncia.
+ *
+ * S consulta as 8 posies vizinhas; pares j ligados no so duplicados.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return int 0 se sucesso, -1 se parmetros invlidos, -2 se faltar memria.
+ */
+int ligarVizinhosAdjacentes(GR* grafo, Vertice* v);
+
+/**
+ * @brief Remove todas as arestas de um vrtice e as arestas de volta dos seus vizinhos.
+ *
+ * Assume arestas simtricas; o custo depende s do nmero de vizinhos.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return int 0 se sucesso, valor negativo em caso de erro.
+ */
+int desligarVizinhos(GR* grafo, Vertice* v);
 
 /**
  * @brief Cria arestas entre vrtices adjacentes no grafo que tenham a mesma frequncia.
+ * Pares j ligados no so duplicados.
  *
  * @param grafo Apontador para o grafo.
  * @return int 0 se sucesso, valor negativo em caso de erro.
  */
 int criarArestasAdjacentes(GR* grafo);
 
+/**
+ * @brief Cria as arestas entre vrtices adjacentes com a mesma frequncia, percorrendo o mapa linha a linha.
+ *
+ * Gera as mesmas arestas que `criarArestasAdjacentes`, num nico vetor contguo e com
+ * faixas de linhas tratadas em paralelo. As arestas que o grafo j tenha so descartadas.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param numThreads Nmero de threads (se <= 0, usa o nmero de processadores).
+ * @return int 0 se sucesso, -1 se o grafo for invlido, -2 se faltar memria.
+ */
+int criarArestasAdjacentesPorLinhas(GR* grafo, int numThreads);
+
 /**
  * @brief Remove todas as arestas que apontam para um vrtice especfico.
  *
@@ -42,12 +98,13 @@ int criarArestasAdjacentes(GR* grafo);
 int removerArestasParaVertice(GR* grafo, Vertice* alvo);
 
 /**
- * @brief Liberta a memria das arestas associadas a um vrtice.
+ * @brief Liberta a memria das arestas associadas a um vrtice, devolvendo-as ao pool do grafo.
  *
+ * @param grafo Apontador para o grafo a que o vrtice pertence.
  * @param v Apontador para o vrtice cujas arestas sero libertadas.
  * @return int 0 se sucesso, valor negativo em caso de erro.
  */
-int libertarArestasDoVertice(Vertice* v);
+int libertarArestasDoVertice(GR* grafo, Vertice* v);
 
 /**
  * @brief Lista todas as arestas presentes no grafo.
@@ -0,0 +1,186 @@
+/**
+ * @file FuncoesBinario.c
+ * @brief Gravao e leitura do grafo num formato binrio mapevel.
+ *
+ * @details
+ * Formato do ficheiro (ordem de bytes e alinhamento da mquina que o gravou):
+ * - cabealho `CabecalhoBinario` (48 bytes): assinatura, verso, marca de ordem de
+ *   bytes, tamanho de `VerticeCSR`, contagens, dimenses do mapa e tamanho do bloco;
+ * - bloco do grafo CSR, exatamente como est em memria (ver `distribuirBlocoCSR`).
+ *
+ * Como o bloco no contm apontadores, basta mapear o ficheiro e apontar os vetores do
+ * `GrafoCSR` para o contedo mapeado: o carregamento no interpreta texto nem aloca os
+ * vetores. Um ficheiro de outra verso, de outra arquitetura ou truncado  rejeitado pela
+ * validao do cabealho. Depois, `validarGrafoCSR` percorre uma vez todos os offsets,
+ * destinos e IDs (O(V + E + maxId), sequencial), para que um ficheiro corrompido no
+ * provoque acessos fora dos vetores; essa passagem l o bloco inteiro do disco, pelo que
+ * o carregamento no  preguioso.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Structs.h"
+#include "FuncoesBinario.h"
+#include "FuncoesCSR.h"
+#include "FuncoesFicheiro.h"
+#include "FuncoesGrafo.h"
+
+#define ASSINATURA_BINARIO "EDAGRAFO"   // 8 caracteres, sem o '\0'
+#define VERSAO_BINARIO 1u
+#define MARCA_ORDEM_BYTES 0x01020304u
+
+/**
+ * @brief Cabealho do ficheiro binrio. O tamanho (48 bytes)  mltiplo de 8, para que o
+ * bloco que se segue fique alinhado no ficheiro mapeado.
+ */
+typedef struct CabecalhoBinario {
+    char assinatura[8];             /**< ASSINATURA_BINARIO */
+    unsigned int versao;            /**< VERSAO_BINARIO */
+    unsigned int ordemBytes;        /**< MARCA_ORDEM_BYTES, tal como escrita pela mquina de origem */
+    unsigned int tamanhoVertice;    /**< sizeof(VerticeCSR) na mquina de origem */
+    int numVertices;                /**< Nmero de vrtices */
+    int numArestas;                 /**< Nmero de arestas dirigidas */
+    int maxId;                      /**< Maior ID de vrtice */
+    int linhas;                     /**< Nmero de linhas do mapa */
+    int colunas;                    /**< Nmero de colunas do mapa */
+    unsigned long long tamanhoBloco; /**< Tamanho do bloco CSR em bytes */
+} CabecalhoBinario;
+
+/**
+ * @brief Grava o cabealho e o bloco de um grafo CSR num ficheiro.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @param nomeFicheiro Nome do ficheiro a criar.
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se no for possvel escrever o ficheiro.
+ */
+int guardarGrafoCSR(const GrafoCSR* csr, const char* nomeFicheiro) {
+    if (!csr || !nomeFicheiro) return -1;
+
+    CabecalhoBinario c;
+    memset(&c, 0, sizeof(c));
+    memcpy(c.assinatura, ASSINATURA_BINARIO, sizeof(c.assinatura));
+    c.versao = VERSAO_BINARIO;
+    c.ordemBytes = MARCA_ORDEM_BYTES;
+    c.tamanhoVertice = (unsigned int)sizeof(VerticeCSR);
+    c.numVertices = csr->numVertices;
+    c.numArestas = csr->numArestas;
+    c.maxId = csr->maxId;
+    c.linhas = csr->linhas;
+    c.colunas = csr->colunas;
+    c.tamanhoBloco = tamanhoBlocoCSR(csr->numVertices, csr->numArestas, csr->maxId);
+
+    FILE* f = fopen(nomeFicheiro, "wb");
+    if (!f) {
+        perror("Erro ao criar ficheiro");
+        return -2;
+    }
+    int ok = fwrite(&c, sizeof(c), 1, f) == 1 &&
+        fwrite(csr->bloco, 1, (size_t)c.tamanhoBloco, f) == (size_t)c.tamanhoBloco;
+    if (fclose(f) != 0) ok = 0;
+    if (!ok) {
+        remove(nomeFicheiro);  // no deixar um ficheiro incompleto
+        return -2;
+    }
+    return 0;
+}
+
+/**
+ * @brief Congela o grafo e grava-o num ficheiro binrio.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param nomeFicheiro Nome do ficheiro a criar.
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se no for possvel escrever o
+ *         ficheiro, -3 se faltar memria.
+ */
+int guardarGrafoBinario(GR* grafo, const char* nomeFicheiro) {
+    if (!grafo || !nomeFicheiro) return -1;
+
+    GrafoCSR* csr = congelarGrafo(grafo);
+    if (!csr) return -3;
+    int resultado = guardarGrafoCSR(csr, nomeFicheiro);
+    libertarGrafoCSR(csr);
+    return resultado;
+}
+
+/**
+ * @brief Verifica se o cabealho corresponde a um ficheiro vlido para esta mquina.
+ *
+ * @param c Cabealho lido.
+ * @param tamanhoFicheiro Tamanho total do ficheiro.
+ * @return 1 se vlido, 0 caso contrrio.
+ */
+static int cabecalhoValido(const CabecalhoBinario* c, size_t tamanhoFicheiro) {
+    if (memcmp(c->assinatura, ASSINATURA_BINARIO, sizeof(c->assinatura)) != 0) return 0;
+    if (c->versao != VERSAO_BINARIO) return 0;
+    if (c->ordemBytes != MARCA_ORDEM_BYTES) return 0;           // outra ordem de bytes
+    if (c->tamanhoVertice != sizeof(VerticeCSR)) return 0;      // outro alinhamento
+    if (c->numVertices < 0 || c->numArestas < 0 || c->maxId < -1) return 0;
+    if (c->numVertices > 0 && c->maxId < 0) return 0;
+    if (c->tamanhoBloco != tamanhoBlocoCSR(c->numVertices, c->numArestas, c->maxId)) return 0;
+    return tamanhoFicheiro - sizeof(CabecalhoBinario) >= c->tamanhoBloco;
+}
+
+/**
+ * @brief Mapeia um ficheiro binrio e devolve o grafo CSR que ele contm.
+ *
+ * Alm do cabealho, o bloco  verificado com `validarGrafoCSR` (offsets, destinos e IDs)
+ * antes de o grafo ser devolvido, para que um ficheiro corrompido no provoque acessos
+ * fora dos vetores nas procuras nem em `descongelarGrafo`.
+ *
+ * @param nomeFicheiro Nome do ficheiro binrio.
+ * @return Apontador para o grafo CSR, ou NULL se o ficheiro no puder ser lido ou no for vlido.
+ */
+GrafoCSR* carregarGrafoCSRBinario(const char* nomeFicheiro) {
+    if (!nomeFicheiro) return NULL;
+
+    FicheiroMapeado f;
+    if (mapearFicheiroPrivado(nomeFicheiro, &f) != 0) return NULL;  // os vetores do CSR no so const
+
+    const CabecalhoBinario* c = (const CabecalhoBinario*)f.dados;
+    if (f.tamanho < sizeof(CabecalhoBinario) || !cabecalhoValido(c, f.tamanho)) {
+        desmapearFicheiro(&f);
+        return NULL;
+    }
+
+    GrafoCSR* csr = malloc(sizeof(GrafoCSR));
+    if (!csr) {
+        desmapearFicheiro(&f);
+        return NULL;
+    }
+    csr->numVertices = c->numVertices;
+    csr->numArestas = c->numArestas;
+    csr->linhas = c->linhas;
+    csr->colunas = c->colunas;
+    csr->maxId = c->maxId;
+    csr->bloco = (void*)(f.dados + sizeof(CabecalhoBinario));  // cpia privada do ficheiro
+    csr->ficheiro = f;
+    distribuirBlocoCSR(csr);
+
+    if (validarGrafoCSR(csr) != 0) {
+        libertarGrafoCSR(csr);
+        return NULL;
+    }
+    return csr;
+}
+
+/**
+ * @brief Carrega um ficheiro binrio e reconstri o grafo ligado.
+ *
+ * @param nomeFicheiro Nome do ficheiro binrio.
+ * @return Apontador para o grafo, ou NULL em caso de erro.
+ */
+GR* carregarGrafoBinario(const char* nomeFicheiro) {
+    GrafoCSR* csr = carregarGrafoCSRBinario(nomeFicheiro);
+    if (!csr) return NULL;
+
+    GR* grafo = descongelarGrafo(csr);
+    libertarGrafoCSR(csr);
+    return grafo;
+}
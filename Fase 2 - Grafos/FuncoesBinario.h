@@ -0,0 +1,60 @@
+#ifndef FUNCOESBINARIO_H
+#define FUNCOESBINARIO_H
+
+/**
+ * @file FuncoesBinario.h
+ * @brief Declarao das funes de gravao e leitura do grafo em formato binrio.
+ *
+ * O ficheiro binrio guarda um cabealho versionado seguido do bloco do grafo CSR
+ * (vrtices, arestas com pesos e tabela de IDs). Ao carregar, o ficheiro  mapeado
+ * em memria e usado diretamente, sem voltar a ler o mapa nem a criar as arestas.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "Structs.h"
+
+ /**
+  * @brief Grava um grafo CSR num ficheiro binrio.
+  *
+  * @param csr Apontador para o grafo CSR.
+  * @param nomeFicheiro Nome do ficheiro a criar (substitudo se existir).
+  * @return 0 se sucesso, -1 se parmetros invlidos, -2 se no for possvel escrever o ficheiro.
+  */
+int guardarGrafoCSR(const GrafoCSR* csr, const char* nomeFicheiro);
+
+/**
+ * @brief Grava um grafo (vrtices, arestas e dimenses do mapa) num ficheiro binrio.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param nomeFicheiro Nome do ficheiro a criar (substitudo se existir).
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se no for possvel escrever o ficheiro,
+ *         -3 se faltar memria.
+ */
+int guardarGrafoBinario(GR* grafo, const char* nomeFicheiro);
+
+/**
+ * @brief Carrega um ficheiro binrio como grafo CSR, mapeando-o em memria.
+ *
+ * Os vetores do grafo apontam diretamente para o ficheiro mapeado em cpia na escrita
+ * (`mapearFicheiroPrivado`): o que se escrever neles vai para uma cpia privada e nunca
+ * chega ao ficheiro. Antes de ser devolvido, o bloco  percorrido uma vez por
+ * `validarGrafoCSR` (O(V + E + maxId)), pelo que todo o ficheiro  lido do disco.
+ * O grafo deve ser libertado com `libertarGrafoCSR`.
+ *
+ * @param nomeFicheiro Nome do ficheiro binrio.
+ * @return Apontador para o grafo CSR ou NULL se o ficheiro no existir ou no for vlido.
+ */
+GrafoCSR* carregarGrafoCSRBinario(const char* nomeFicheiro);
+
+/**
+ * @brief Carrega um ficheiro binrio como grafo ligado, pronto a ser alterado.
+ *
+ * @param nomeFicheiro Nome do ficheiro binrio.
+ * @return Apontador para o grafo ou NULL se o ficheiro no existir, no for vlido ou faltar memria.
+ */
+GR* carregarGrafoBinario(const char* nomeFicheiro);
+
+#endif // FUNCOESBINARIO_H
@@ -4,12 +4,22 @@
  *
  * @details
  * Este ficheiro contm implementaes de algoritmos bsicos de procura em grafos:
- * - Depth-First Traversal (DFT)
+ * - Depth-First Traversal (DFT), iterativo com pilha explcita
  * - Breadth-First Traversal (BFT)
  * - Procura recursiva de todos os caminhos entre dois vrtices
  *
  * Alm disso, tem funes auxiliares para resetar o estado dos vrtices e imprimir resultados.
  *
+ * As verses `...Contexto` fazem as mesmas procuras, pela mesma ordem, mas guardam as
+ * marcas de visita num `ContextoProcura` em vez de `Vertice::visitado`: no precisam de
+ * `resetarVisitados` e no alteram o grafo, pelo que podem correr em paralelo (um
+ * contexto por thread).
+ *
+ * As verses `...Visitante` entregam cada vrtice (ou caminho) a uma funo do chamador
+ * em vez de o imprimir; a impresso  s um dos visitantes possveis
+ * (`imprimirVerticeVisitante`, `imprimirCaminhoVisitante`), que pode escrever numa
+ * `SaidaBuffer` em vez de fazer um `printf` por linha.
+ *
  * @author Duarte "macrogod" Pereira
  * @date 2025-05-18
  * @version 1.0
@@ -19,6 +29,10 @@
 #include <stdlib.h>
 #include "Structs.h"
 #include "FuncoesVertice.h"
+#include "FuncoesBusca.h"
+#include "FuncoesContexto.h"
+#include "FuncoesIndice.h"
+#include "FuncoesSaida.h"
 
  /**
   * @brief Reseta o estado de visita de todos os vrtices do grafo.
@@ -57,24 +71,133 @@ Vertice* getVizinhoNaoVisitado(Vertice* v) {
 }
 
 /**
- * @brief Percurso em profundidade (Depth-First Traversal) recursivo a partir de um vrtice.
+ * @brief Pilha da procura em profundidade: o vrtice de cada nvel e a prxima aresta
+ * a explorar a partir dele.
+ */
+typedef struct PilhaProcura {
+    Vertice** vertices;   /**< Vrtice de cada nvel */
+    Aresta** cursores;    /**< Prxima aresta de cada nvel */
+    int capacidade;       /**< Nmero de nveis disponveis */
+    int propria;          /**< 1 se a pilha foi alocada aqui e pode crescer */
+} PilhaProcura;
+
+#define CAPACIDADE_INICIAL_PROCURA 64
+
+/**
+ * @brief Duplica a capacidade de uma pilha prpria.
+ *
+ * @return 0 se sucesso, -1 se a pilha no puder crescer.
+ */
+static int crescerPilha(PilhaProcura* pilha) {
+    if (!pilha->propria) return -1;
+    int capacidade = pilha->capacidade * 2;
+
+    Vertice** vertices = realloc(pilha->vertices, (size_t)capacidade * sizeof(Vertice*));
+    if (!vertices) return -1;
+    pilha->vertices = vertices;
+    Aresta** cursores = realloc(pilha->cursores, (size_t)capacidade * sizeof(Aresta*));
+    if (!cursores) return -1;
+    pilha->cursores = cursores;
+    pilha->capacidade = capacidade;
+    return 0;
+}
+
+/**
+ * @brief Indica se um vrtice j foi visitado, no contexto ou, sem contexto, no prprio vrtice.
+ */
+static int estaVisitado(const ContextoProcura* ctx, const Vertice* v) {
+    return ctx ? foiVisitado(ctx, v) : v->visitado;
+}
+
+/**
+ * @brief Indica se um vrtice tem um ndice denso vlido no grafo (no foi rejeitado nem removido).
+ */
+static int verticeIndexado(const GR* grafo, const Vertice* v) {
+    return grafo && v && v->indice >= 0 && v->indice < grafo->numVertices;
+}
+
+/**
+ * @brief Marca um vrtice como visitado, no contexto ou, sem contexto, no prprio vrtice.
+ */
+static void visitar(ContextoProcura* ctx, Vertice* v) {
+    if (ctx) marcarVisitado(ctx, v);
+    else v->visitado = 1;
+}
+
+/**
+ * @brief Percurso em profundidade iterativo, com uma pilha explcita.
+ *
+ * Cada nvel da pilha guarda a prxima aresta a explorar, pelo que cada lista de
+ * adjacncia  percorrida uma nica vez (O(V + E)). A ordem de visita  a da verso
+ * recursiva: um vizinho saltado por j estar visitado nunca volta a ficar por visitar,
+ * pelo que continuar do cursor equivale a recomear do incio da lista.
+ *
+ * @param ctx Contexto com as marcas de visita, ou NULL para usar `Vertice::visitado`.
+ * @param pilha Pilha a usar.
+ * @param v Vrtice inicial (ainda no visitado).
+ * @param visitante Funo chamada para cada vrtice visitado.
+ * @param dados Apontador passado ao visitante.
+ * @return Nmero de vrtices visitados, ou -1 se a pilha no puder crescer ou o visitante falhar.
+ */
+static int dftIterativo(ContextoProcura* ctx, PilhaProcura* pilha, Vertice* v,
+    VisitanteVertice visitante, void* dados) {
+    int topo = 0;
+    visitar(ctx, v);
+    int r = visitante(v, dados);
+    if (r != 0) return r < 0 ? -1 : 1;
+    pilha->vertices[0] = v;
+    pilha->cursores[0] = v->adj;
+    int count = 1;
+
+    while (topo >= 0) {
+        Aresta* a = pilha->cursores[topo];
+        while (a && estaVisitado(ctx, a->destino)) {
+            a = a->next;
+        }
+        if (!a) {  // sem vizinhos por visitar: recuar
+            topo--;
+            continue;
+        }
+        pilha->cursores[topo] = a->next;
+
+        Vertice* vizinho = a->destino;
+        if (topo + 1 == pilha->capacidade && crescerPilha(pilha) != 0) return -1;
+        visitar(ctx, vizinho);
+        count++;
+        r = visitante(vizinho, dados);
+        if (r < 0) return -1;
+        if (r > 0) break;
+        topo++;
+        pilha->vertices[topo] = vizinho;
+        pilha->cursores[topo] = vizinho->adj;
+    }
+    return count;
+}
+
+/**
+ * @brief Percurso em profundidade (Depth-First Traversal) a partir de um vrtice.
  *
- * Marca o vrtice atual como visitado, imprime-o e faz recurso para os seus vizinhos no visitados.
+ * Marca cada vrtice como visitado e imprime-o, descendo para o primeiro vizinho no
+ * visitado e recuando quando j no houver nenhum. Usa uma pilha explcita em vez de
+ * recurso, pelo que componentes com milhes de vrtices no esgotam a pilha do programa.
  *
  * @param v Apontador para o vrtice inicial da procura.
- * @return Nmero total de vrtices visitados durante a travessia.
+ * @return Nmero total de vrtices visitados durante a travessia, ou -1 se faltar memria.
  */
 int dft(Vertice* v) {
     if (v == NULL || v->visitado) return 0;
 
-    v->visitado = 1;
-    imprimirVertice(v);
-
-    int count = 1;
-    Vertice* vizinho;
-    while ((vizinho = getVizinhoNaoVisitado(v)) != NULL) {
-        count += dft(vizinho);
+    PilhaProcura pilha;
+    pilha.vertices = malloc(CAPACIDADE_INICIAL_PROCURA * sizeof(Vertice*));
+    pilha.cursores = malloc(CAPACIDADE_INICIAL_PROCURA * sizeof(Aresta*));
+    pilha.capacidade = CAPACIDADE_INICIAL_PROCURA;
+    pilha.propria = 1;
+    int count = -1;
+    if (pilha.vertices && pilha.cursores) {
+        count = dftIterativo(NULL, &pilha, v, imprimirVerticeVisitante, NULL);
     }
+    free(pilha.vertices);
+    free(pilha.cursores);
     return count;
 }
 
@@ -97,16 +220,19 @@ int filaVazia(int inicio, int fim) {
  * Utiliza uma fila para visitar vrtices em camadas, comeando pelo vrtice inicial.
  *
  * @param inicio Apontador para o vrtice inicial da procura.
- * @return Nmero total de vrtices visitados durante a travessia.
+ * @return Nmero total de vrtices visitados durante a travessia, ou -1 se faltar memria.
  *
  * @details
  * Marca os vrtices como visitados  medida que so inseridos na fila,
- * evitando visitas repetidas.
+ * evitando visitas repetidas. A fila fica no heap e duplica quando enche, pelo
+ * que no h limite para o tamanho da componente.
  */
 int bft(Vertice* inicio) {
     if (inicio == NULL) return 0;
 
-    Vertice* fila[1000];
+    int capacidade = CAPACIDADE_INICIAL_PROCURA;
+    Vertice** fila = malloc((size_t)capacidade * sizeof(Vertice*));
+    if (!fila) return -1;
     int inicioFila = 0, fimFila = 0;
 
     int count = 0;
@@ -115,18 +241,28 @@ int bft(Vertice* inicio) {
 
     while (!filaVazia(inicioFila, fimFila)) {
         Vertice* v = fila[inicioFila++];
-        imprimirVertice(v);
+        imprimirVerticeVisitante(v, NULL);  // com printf no falha
         count++;
 
         Aresta* a = v->adj;
         while (a != NULL) {
             if (!a->destino->visitado) {
+                if (fimFila == capacidade) {
+                    Vertice** nova = realloc(fila, (size_t)capacidade * 2 * sizeof(Vertice*));
+                    if (!nova) {
+                        free(fila);
+                        return -1;
+                    }
+                    fila = nova;
+                    capacidade *= 2;
+                }
                 a->destino->visitado = 1;
                 fila[fimFila++] = a->destino;
             }
             a = a->next;
         }
     }
+    free(fila);
     return count;
 }
 
@@ -145,6 +281,56 @@ void imprimirCaminho(Vertice* caminho[], int tamanho) {
     printf("FIM\n");
 }
 
+/**
+ * @brief Visitante que imprime um vrtice.
+ *
+ * @param v Apontador para o vrtice.
+ * @param dados `SaidaBuffer*` onde escrever, ou NULL para imprimir com `printf`.
+ * @return 0 (continuar a procura), ou -1 se a escrita falhar (a procura termina com erro).
+ */
+int imprimirVerticeVisitante(Vertice* v, void* dados) {
+    if (!dados) {
+        imprimirVertice(v);
+        return 0;
+    }
+    return escreverSaida((SaidaBuffer*)dados, "ID: %d  Freq: %c  Coord: (%d,%d)\n", v->id, v->frequencia, v->x, v->y);
+}
+
+/**
+ * @brief Visitante que imprime um caminho no mesmo formato de `imprimirCaminho`.
+ *
+ * @param caminho Vrtices do caminho.
+ * @param tamanho Nmero de vrtices.
+ * @param dados `SaidaBuffer*` onde escrever, ou NULL para imprimir com `printf`.
+ * @return 0 (continuar a procura), ou -1 se a escrita falhar (a procura termina com erro).
+ */
+int imprimirCaminhoVisitante(Vertice* caminho[], int tamanho, void* dados) {
+    if (!dados) {
+        imprimirCaminho(caminho, tamanho);
+        return 0;
+    }
+    SaidaBuffer* saida = dados;
+    for (int i = 0; i < tamanho; i++) {
+        if (escreverSaida(saida, "ID: %d (%c) -> ", caminho[i]->id, caminho[i]->frequencia) != 0) return -1;
+    }
+    return escreverSaida(saida, "FIM\n");
+}
+
+/**
+ * @brief Visitante que guarda o ID de cada vrtice numa `ListaIds`.
+ *
+ * @param v Apontador para o vrtice.
+ * @param dados `ListaIds*` de destino.
+ * @return 0 enquanto houver espao, 1 quando a lista fica cheia (a procura pra).
+ */
+int guardarIdVisitante(Vertice* v, void* dados) {
+    ListaIds* lista = dados;
+    if (lista->tamanho < lista->capacidade) {
+        lista->ids[lista->tamanho++] = v->id;
+    }
+    return lista->tamanho >= lista->capacidade;
+}
+
 /**
  * @brief Encontra e imprime todos os caminhos entre dois vrtices.
  *
@@ -155,29 +341,44 @@ void imprimirCaminho(Vertice* caminho[], int tamanho) {
  * @param destino Apontador para o vrtice destino que queremos alcanar.
  * @param caminho Array de apontadores para armazenar o caminho corrente.
  * @param pos Posio atual no array caminho.
- * @return Nmero total de caminhos encontrados entre `atual` e `destino`.
+ * @param capacidade Nmero de posies de `caminho`.
+ * @param omitidos Se no for NULL,  incrementado por cada caminho encontrado que no cabe
+ *        em `caminho` (e por isso no  impresso).
+ * @return Nmero total de caminhos encontrados entre `atual` e `destino`, incluindo os omitidos.
  *
  * @details
+ * Os vrtices para l de `capacidade` no so guardados no array, mas a procura continua
+ * com as marcas de visita: os caminhos mais longos so contados em `omitidos` em vez de
+ * serem perdidos sem aviso. Para imprimir caminhos de qualquer comprimento, usar
+ * `enumerarCaminhos`.
  * A cada chamada, o vrtice atual  marcado como visitado e adicionado ao caminho.
  * Ao chegar ao destino, imprime o caminho e conta 1 caminho encontrado.
  * Depois, explora recursivamente os vizinhos no visitados.
  * Antes de retornar, desmarca o vrtice para permitir outras rotas.
  */
-int encontrarTodosCaminhos(Vertice* atual, Vertice* destino, Vertice* caminho[], int pos) {
+int encontrarTodosCaminhos(Vertice* atual, Vertice* destino, Vertice* caminho[], int pos, int capacidade,
+    int* omitidos) {
     atual->visitado = 1;
-    caminho[pos] = atual;
+    if (pos < capacidade) {
+        caminho[pos] = atual;
+    }
     pos++;
 
     int totalCaminhos = 0;
     if (atual == destino) {
-        imprimirCaminho(caminho, pos);
+        if (pos <= capacidade) {
+            imprimirCaminhoVisitante(caminho, pos, NULL);  // com printf no falha
+        }
+        else if (omitidos) {
+            (*omitidos)++;  // o caminho no cabe no array
+        }
         totalCaminhos = 1;
     }
     else {
         Aresta* a = atual->adj;
         while (a != NULL) {
             if (!a->destino->visitado) {
-                totalCaminhos += encontrarTodosCaminhos(a->destino, destino, caminho, pos);
+                totalCaminhos += encontrarTodosCaminhos(a->destino, destino, caminho, pos, capacidade, omitidos);
             }
             a = a->next;
         }
@@ -185,4 +386,241 @@ int encontrarTodosCaminhos(Vertice* atual, Vertice* destino, Vertice* caminho[],
 
     atual->visitado = 0;
     return totalCaminhos;
-}
\ No newline at end of file
+}
+/**
+ * @brief Percurso em profundidade que entrega cada vrtice visitado a um visitante.
+ *
+ * @param ctx Apontador para o contexto (uma thread de cada vez).
+ * @param grafo Apontador para o grafo que contm `v`.
+ * @param v Apontador para o vrtice inicial.
+ * @param visitante Funo chamada para cada vrtice; se devolver um valor positivo, a procura pra.
+ * @param dados Apontador passado ao visitante.
+ * @return Nmero de vrtices visitados, ou -1 se parmetros invlidos, faltar memria ou o
+ *         visitante devolver um valor negativo.
+ */
+int dftVisitante(ContextoProcura* ctx, const GR* grafo, Vertice* v, VisitanteVertice visitante, void* dados) {
+    if (!verticeIndexado(grafo, v) || visitante == NULL || iniciarProcura(ctx, grafo) != 0) return -1;
+
+    PilhaProcura pilha = { ctx->fila, ctx->cursores, ctx->capacidade, 0 };  // profundidade <= numVertices
+    return dftIterativo(ctx, &pilha, v, visitante, dados);
+}
+
+/**
+ * @brief Percurso em profundidade com as marcas de visita num contexto.
+ *
+ * @param ctx Apontador para o contexto (uma thread de cada vez).
+ * @param grafo Apontador para o grafo que contm `v`.
+ * @param v Apontador para o vrtice inicial.
+ * @return Nmero de vrtices visitados, ou -1 se parmetros invlidos ou faltar memria.
+ */
+int dftContexto(ContextoProcura* ctx, const GR* grafo, Vertice* v) {
+    return dftVisitante(ctx, grafo, v, imprimirVerticeVisitante, NULL);
+}
+
+/**
+ * @brief Procura em largura com distncias e antecessores, que entrega cada vrtice a um
+ * visitante (se houver) quando sai da fila.
+ *
+ * A fila  o vetor `ctx->fila`, com uma posio por vrtice do grafo: cada vrtice
+ * entra na fila no mximo uma vez, pelo que nunca transborda e, com o contexto j
+ * dimensionado, a procura no aloca memria.
+ *
+ * @param ctx Apontador para o contexto (uma thread de cada vez).
+ * @param grafo Apontador para o grafo que contm `origem`.
+ * @param origem Apontador para o vrtice inicial.
+ * @param visitante Funo chamada para cada vrtice, ou NULL.
+ * @param dados Apontador passado ao visitante.
+ * @return Sem visitante, nmero de vrtices alcanados; com visitante, nmero de vrtices
+ *         entregues. -1 se parmetros invlidos, faltar memria ou o visitante falhar.
+ */
+static int larguraVisitante(ContextoProcura* ctx, const GR* grafo, Vertice* origem,
+    VisitanteVertice visitante, void* dados) {
+    if (!verticeIndexado(grafo, origem) || iniciarProcura(ctx, grafo) != 0) return -1;
+
+    Vertice** fila = ctx->fila;
+    int inicioFila = 0, fimFila = 0;
+
+    ctx->epocaLargura = ctx->epoca;
+    marcarVisitado(ctx, origem);
+    ctx->distancias[origem->indice] = 0;
+    ctx->pais[origem->indice] = -1;
+    fila[fimFila++] = origem;
+
+    while (!filaVazia(inicioFila, fimFila)) {
+        Vertice* v = fila[inicioFila++];
+        if (visitante) {
+            int r = visitante(v, dados);
+            if (r < 0) return -1;
+            if (r > 0) return inicioFila;  // os vizinhos de v j no so precisos
+        }
+        int distancia = ctx->distancias[v->indice] + 1;
+
+        Aresta* a = v->adj;
+        while (a != NULL) {
+            Vertice* w = a->destino;
+            if (!foiVisitado(ctx, w)) {
+                marcarVisitado(ctx, w);
+                ctx->distancias[w->indice] = distancia;
+                ctx->pais[w->indice] = v->indice;
+                fila[fimFila++] = w;
+            }
+            a = a->next;
+        }
+    }
+    return fimFila;
+}
+
+/**
+ * @brief Procura em largura sem impresso, com distncias e antecessores.
+ *
+ * No fim, `ctx->fila[0 .. n-1]` contm os vrtices visitados pela ordem da visita.
+ *
+ * @param ctx Apontador para o contexto (uma thread de cada vez).
+ * @param grafo Apontador para o grafo que contm `origem`.
+ * @param origem Apontador para o vrtice inicial.
+ * @return Nmero de vrtices visitados (n), ou -1 se parmetros invlidos ou faltar memria.
+ */
+int procurarEmLargura(ContextoProcura* ctx, const GR* grafo, Vertice* origem) {
+    return larguraVisitante(ctx, grafo, origem, NULL, NULL);
+}
+
+/**
+ * @brief Devolve a distncia (em arestas) de um vrtice  origem da ltima procura em largura.
+ *
+ * @param ctx Apontador para o contexto usado na procura.
+ * @param v Apontador para o vrtice.
+ * @return Nmero de arestas, ou -1 se o vrtice no foi alcanado ou se a ltima procura
+ *         do contexto no foi uma procura em largura.
+ */
+int distanciaProcura(const ContextoProcura* ctx, const Vertice* v) {
+    if (!ctx || !v || !indiceNoContexto(ctx, v) || ctx->epocaLargura != ctx->epoca || !foiVisitado(ctx, v)) return -1;
+    return ctx->distancias[v->indice];
+}
+
+/**
+ * @brief Devolve o antecessor de um vrtice no caminho mais curto encontrado pela
+ * ltima procura em largura ou de caminho mais curto.
+ *
+ * @param ctx Apontador para o contexto usado na procura.
+ * @param grafo Apontador para o grafo da procura.
+ * @param v Apontador para o vrtice.
+ * @return Apontador para o antecessor, ou NULL se `v` for a origem, no foi alcanado ou
+ *         se a ltima procura do contexto no calculou antecessores (por exemplo, `dftContexto`).
+ */
+Vertice* paiProcura(const ContextoProcura* ctx, const GR* grafo, const Vertice* v) {
+    if (!ctx || !v || !indiceNoContexto(ctx, v) || !foiVisitado(ctx, v)) return NULL;
+    if (ctx->epocaLargura != ctx->epoca && ctx->epocaCaminho != ctx->epoca) return NULL;
+    return consultarIndice(grafo, ctx->pais[v->indice]);
+}
+
+/**
+ * @brief Percurso em largura que entrega cada vrtice visitado a um visitante.
+ *
+ * O visitante  chamado  medida que cada vrtice sai da fila, pela ordem da visita: se
+ * pedir para parar, o resto da componente no  explorado.
+ *
+ * @param ctx Apontador para o contexto (uma thread de cada vez).
+ * @param grafo Apontador para o grafo que contm `inicio`.
+ * @param inicio Apontador para o vrtice inicial.
+ * @param visitante Funo chamada para cada vrtice; se devolver um valor positivo, pra.
+ * @param dados Apontador passado ao visitante.
+ * @return Nmero de vrtices entregues ao visitante, ou -1 se parmetros invlidos, faltar
+ *         memria ou o visitante devolver um valor negativo.
+ */
+int bftVisitante(ContextoProcura* ctx, const GR* grafo, Vertice* inicio, VisitanteVertice visitante, void* dados) {
+    if (visitante == NULL) return -1;
+    return larguraVisitante(ctx, grafo, inicio, visitante, dados);
+}
+
+/**
+ * @brief Percurso em largura com as marcas de visita num contexto.
+ *
+ * @param ctx Apontador para o contexto (uma thread de cada vez).
+ * @param grafo Apontador para o grafo que contm `inicio`.
+ * @param inicio Apontador para o vrtice inicial.
+ * @return Nmero de vrtices visitados, ou -1 se parmetros invlidos ou faltar memria.
+ */
+int bftContexto(ContextoProcura* ctx, const GR* grafo, Vertice* inicio) {
+    return bftVisitante(ctx, grafo, inicio, imprimirVerticeVisitante, NULL);
+}
+
+/**
+ * @brief Estado partilhado pela procura recursiva de caminhos com visitante.
+ */
+typedef struct ProcuraCaminhos {
+    ContextoProcura* ctx;        /**< Marcas e caminho corrente */
+    Vertice* destino;            /**< Vrtice de chegada */
+    VisitanteCaminho visitante;  /**< Recebe cada caminho */
+    void* dados;                 /**< Passado ao visitante */
+    int parar;                   /**< 1 depois de o visitante pedir para parar */
+    int erro;                    /**< 1 se o visitante falhou */
+} ProcuraCaminhos;
+
+/**
+ * @brief Parte recursiva de `encontrarTodosCaminhosVisitante`.
+ */
+static int caminhosContextoRecursivo(ProcuraCaminhos* p, Vertice* atual, int pos) {
+    ContextoProcura* ctx = p->ctx;
+    marcarVisitado(ctx, atual);
+    ctx->caminho[pos] = atual;
+    pos++;
+
+    int totalCaminhos = 0;
+    if (atual == p->destino) {
+        totalCaminhos = 1;
+        int r = p->visitante(ctx->caminho, pos, p->dados);
+        if (r != 0) p->parar = 1;
+        if (r < 0) p->erro = 1;
+    }
+    else {
+        Aresta* a = atual->adj;
+        while (a != NULL && !p->parar) {
+            if (!foiVisitado(ctx, a->destino)) {
+                totalCaminhos += caminhosContextoRecursivo(p, a->destino, pos);
+            }
+            a = a->next;
+        }
+    }
+
+    desmarcarVisitado(ctx, atual);
+    return totalCaminhos;
+}
+
+/**
+ * @brief Encontra todos os caminhos entre dois vrtices e entrega cada um a um visitante.
+ *
+ * @param ctx Apontador para o contexto (uma thread de cada vez).
+ * @param grafo Apontador para o grafo que contm os dois vrtices.
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @param visitante Funo chamada para cada caminho; se devolver um valor positivo, a procura pra.
+ * @param dados Apontador passado ao visitante.
+ * @return Nmero de caminhos entregues, ou -1 se parmetros invlidos, faltar memria ou o
+ *         visitante devolver um valor negativo.
+ */
+int encontrarTodosCaminhosVisitante(ContextoProcura* ctx, const GR* grafo, Vertice* origem, Vertice* destino,
+    VisitanteCaminho visitante, void* dados) {
+    if (!verticeIndexado(grafo, origem) || !verticeIndexado(grafo, destino) || visitante == NULL
+        || iniciarProcura(ctx, grafo) != 0) return -1;
+
+    ProcuraCaminhos p = { ctx, destino, visitante, dados, 0, 0 };
+    int total = caminhosContextoRecursivo(&p, origem, 0);
+    return p.erro ? -1 : total;
+}
+
+/**
+ * @brief Encontra e imprime todos os caminhos entre dois vrtices, com as marcas de
+ * visita e o caminho corrente guardados num contexto.
+ *
+ * O caminho corrente usa `ctx->caminho`, com uma posio por vrtice do grafo, pelo que
+ * no h limite para o comprimento dos caminhos.
+ *
+ * @param ctx Apontador para o contexto (uma thread de cada vez).
+ * @param grafo Apontador para o grafo que contm os dois vrtices.
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @return Nmero de caminhos encontrados, ou -1 se parmetros invlidos ou faltar memria.
+ */
+int encontrarTodosCaminhosContexto(ContextoProcura* ctx, const GR* grafo, Vertice* origem, Vertice* destino) {
+    return encontrarTodosCaminhosVisitante(ctx, grafo, origem, destino, imprimirCaminhoVisitante, NULL);
+}
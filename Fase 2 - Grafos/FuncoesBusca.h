@@ -15,6 +15,27 @@
 
 #include "Structs.h"
 
+ /**
+  * @brief Funo chamada pelas procuras para cada vrtice visitado.
+  *
+  * @param v Vrtice visitado.
+  * @param dados Apontador dado pelo chamador da procura.
+  * @return 0 para continuar a procura, um valor positivo para a terminar, ou um valor
+  *         negativo em caso de erro (a procura termina e devolve -1).
+  */
+typedef int (*VisitanteVertice)(Vertice* v, void* dados);
+
+/**
+ * @brief Funo chamada para cada caminho encontrado.
+ *
+ * @param caminho Vrtices do caminho, da origem ao destino (vlidos s durante a chamada).
+ * @param tamanho Nmero de vrtices do caminho.
+ * @param dados Apontador dado pelo chamador da procura.
+ * @return 0 para continuar a procura, um valor positivo para a terminar, ou um valor
+ *         negativo em caso de erro (a procura termina e devolve -1).
+ */
+typedef int (*VisitanteCaminho)(Vertice* caminho[], int tamanho, void* dados);
+
  /**
   * @brief Reseta o estado 'visitado' de todos os vrtices do grafo para 0.
   *
@@ -33,10 +54,11 @@ Vertice* getVizinhoNaoVisitado(Vertice* v);
 
 /**
  * @brief Realiza uma procura em profundidade (Depth-First Traversal) a partir de um vrtice.
- * Marca os vrtices visitados e imprime-os durante a visita.
+ * Marca os vrtices visitados e imprime-os durante a visita.  iterativa (pilha no heap),
+ * pelo que suporta componentes de qualquer tamanho.
  *
  * @param v Apontador para o vrtice inicial.
- * @return int Nmero de vrtices visitados.
+ * @return int Nmero de vrtices visitados, ou -1 se faltar memria.
  */
 int dft(Vertice* v);
 
@@ -54,7 +76,7 @@ int filaVazia(int inicio, int fim);
  * Marca os vrtices visitados e imprime-os durante a visita.
  *
  * @param inicio Apontador para o vrtice inicial.
- * @return int Nmero de vrtices visitados.
+ * @return int Nmero de vrtices visitados, ou -1 se faltar memria.
  */
 int bft(Vertice* inicio);
 
@@ -66,6 +88,35 @@ int bft(Vertice* inicio);
  */
 void imprimirCaminho(Vertice* caminho[], int tamanho);
 
+/**
+ * @brief Visitante que imprime um vrtice, no formato de `imprimirVertice`.
+ *
+ * @param v Vrtice a imprimir.
+ * @param dados `SaidaBuffer*` onde escrever, ou NULL para imprimir diretamente com `printf`.
+ * @return int 0, ou -1 se a escrita falhar.
+ */
+int imprimirVerticeVisitante(Vertice* v, void* dados);
+
+/**
+ * @brief Visitante que imprime um caminho, no formato de `imprimirCaminho`.
+ *
+ * @param caminho Vrtices do caminho.
+ * @param tamanho Nmero de vrtices do caminho.
+ * @param dados `SaidaBuffer*` onde escrever, ou NULL para imprimir diretamente com `printf`.
+ * @return int 0, ou -1 se a escrita falhar.
+ */
+int imprimirCaminhoVisitante(Vertice* caminho[], int tamanho, void* dados);
+
+/**
+ * @brief Visitante que acrescenta o ID de cada vrtice a uma `ListaIds`.
+ * A procura pra quando a lista fica cheia.
+ *
+ * @param v Vrtice visitado.
+ * @param dados `ListaIds*` de destino.
+ * @return int 0 enquanto houver espao, 1 quando a lista fica cheia.
+ */
+int guardarIdVisitante(Vertice* v, void* dados);
+
 /**
  * @brief Encontra e imprime todos os caminhos possveis entre dois vrtices no grafo.
  * Usa procura recursiva para explorar todos os caminhos sem repetir vrtices.
@@ -74,8 +125,124 @@ void imprimirCaminho(Vertice* caminho[], int tamanho);
  * @param destino Vrtice destino da procura.
  * @param caminho Array auxiliar para armazenar o caminho atual.
  * @param pos Posio atual no array caminho.
- * @return int Nmero total de caminhos encontrados.
+ * @param capacidade Nmero de posies de `caminho`.
+ * @param omitidos Se no for NULL, recebe mais 1 por cada caminho com mais de `capacidade`
+ *        vrtices: esses caminhos so contados mas no impressos.
+ * @return int Nmero total de caminhos encontrados, incluindo os omitidos.
+ */
+int encontrarTodosCaminhos(Vertice* atual, Vertice* destino, Vertice* caminho[], int pos, int capacidade,
+    int* omitidos);
+
+/**
+ * @brief Percurso em profundidade que entrega cada vrtice a um visitante, pela ordem de `dft`.
+ *
+ * @param ctx Apontador para o contexto de procura (um por thread).
+ * @param grafo Apontador para o grafo que contm `v`.
+ * @param v Apontador para o vrtice inicial.
+ * @param visitante Funo chamada para cada vrtice visitado.
+ * @param dados Apontador passado ao visitante.
+ * @return int Nmero de vrtices visitados, ou -1 em caso de erro (incluindo um erro do visitante).
+ */
+int dftVisitante(ContextoProcura* ctx, const GR* grafo, Vertice* v, VisitanteVertice visitante, void* dados);
+
+/**
+ * @brief Percurso em profundidade que guarda as marcas de visita num contexto.
+ * Visita e imprime os vrtices pela mesma ordem que `dft`, sem alterar o grafo.
+ *
+ * @param ctx Apontador para o contexto de procura (um por thread).
+ * @param grafo Apontador para o grafo que contm `v`.
+ * @param v Apontador para o vrtice inicial.
+ * @return int Nmero de vrtices visitados, ou -1 em caso de erro.
+ */
+int dftContexto(ContextoProcura* ctx, const GR* grafo, Vertice* v);
+
+/**
+ * @brief Procura em largura sem impresso, que regista a distncia (em arestas) e o
+ * antecessor de cada vrtice alcanado. Usa apenas os vetores do contexto, pelo que
+ * procuras repetidas com o mesmo contexto no alocam memria.
+ *
+ * No fim, `ctx->fila[0 .. n-1]` contm os vrtices alcanados pela ordem da visita.
+ *
+ * @param ctx Apontador para o contexto de procura (um por thread).
+ * @param grafo Apontador para o grafo que contm `origem`.
+ * @param origem Apontador para o vrtice inicial.
+ * @return int Nmero de vrtices alcanados (n), ou -1 em caso de erro.
+ */
+int procurarEmLargura(ContextoProcura* ctx, const GR* grafo, Vertice* origem);
+
+/**
+ * @brief Distncia de um vrtice  origem da ltima `procurarEmLargura` do contexto.
+ *
+ * @param ctx Apontador para o contexto de procura.
+ * @param v Apontador para o vrtice.
+ * @return int Nmero de arestas, ou -1 se o vrtice no foi alcanado ou a ltima procura
+ *         do contexto no foi `procurarEmLargura` (por exemplo, `dftContexto` ou `dijkstra`).
+ */
+int distanciaProcura(const ContextoProcura* ctx, const Vertice* v);
+
+/**
+ * @brief Antecessor de um vrtice na ltima `procurarEmLargura` (ou procura de caminho
+ * mais curto) do contexto.
+ * Seguir os antecessores at  origem d um caminho mais curto (em arestas).
+ *
+ * @param ctx Apontador para o contexto de procura.
+ * @param grafo Apontador para o grafo da procura.
+ * @param v Apontador para o vrtice.
+ * @return Vertice* Antecessor, ou NULL se `v` for a origem, no foi alcanado ou a ltima
+ *         procura do contexto no calculou antecessores.
+ */
+Vertice* paiProcura(const ContextoProcura* ctx, const GR* grafo, const Vertice* v);
+
+/**
+ * @brief Percurso em largura que entrega cada vrtice a um visitante, pela ordem de `bft`.
+ * O visitante  chamado durante a procura, pelo que parar cedo poupa o resto da procura;
+ * as distncias e os antecessores ficam registados para os vrtices j alcanados.
+ *
+ * @param ctx Apontador para o contexto de procura (um por thread).
+ * @param grafo Apontador para o grafo que contm `inicio`.
+ * @param inicio Apontador para o vrtice inicial.
+ * @param visitante Funo chamada para cada vrtice visitado.
+ * @param dados Apontador passado ao visitante.
+ * @return int Nmero de vrtices entregues ao visitante, ou -1 em caso de erro (incluindo um
+ *         erro do visitante).
+ */
+int bftVisitante(ContextoProcura* ctx, const GR* grafo, Vertice* inicio, VisitanteVertice visitante, void* dados);
+
+/**
+ * @brief Percurso em largura que guarda as marcas de visita num contexto.
+ * Visita e imprime os vrtices pela mesma ordem que `bft`, sem alterar o grafo.
+ *
+ * @param ctx Apontador para o contexto de procura (um por thread).
+ * @param grafo Apontador para o grafo que contm `inicio`.
+ * @param inicio Apontador para o vrtice inicial.
+ * @return int Nmero de vrtices visitados, ou -1 em caso de erro.
+ */
+int bftContexto(ContextoProcura* ctx, const GR* grafo, Vertice* inicio);
+
+/**
+ * @brief Encontra todos os caminhos entre dois vrtices e entrega cada um a um visitante.
+ *
+ * @param ctx Apontador para o contexto de procura (um por thread).
+ * @param grafo Apontador para o grafo que contm os vrtices.
+ * @param origem Vrtice de partida.
+ * @param destino Vrtice de chegada.
+ * @param visitante Funo chamada para cada caminho encontrado.
+ * @param dados Apontador passado ao visitante.
+ * @return int Nmero de caminhos encontrados, ou -1 em caso de erro (incluindo um erro do visitante).
+ */
+int encontrarTodosCaminhosVisitante(ContextoProcura* ctx, const GR* grafo, Vertice* origem, Vertice* destino,
+    VisitanteCaminho visitante, void* dados);
+
+/**
+ * @brief Encontra e imprime todos os caminhos entre dois vrtices, como
+ * `encontrarTodosCaminhos`, mas com o estado da procura guardado num contexto.
+ *
+ * @param ctx Apontador para o contexto de procura (um por thread).
+ * @param grafo Apontador para o grafo que contm os vrtices.
+ * @param origem Vrtice de partida.
+ * @param destino Vrtice de chegada.
+ * @return int Nmero total de caminhos encontrados, ou -1 em caso de erro.
  */
-int encontrarTodosCaminhos(Vertice* atual, Vertice* destino, Vertice* caminho[], int pos);
+int encontrarTodosCaminhosContexto(ContextoProcura* ctx, const GR* grafo, Vertice* origem, Vertice* destino);
 
 #endif // FUNCOESBUSCA_H
@@ -0,0 +1,262 @@
+/**
+ * @file FuncoesBuscaParalela.c
+ * @brief Implementao das procuras paralelas sobre o grafo CSR.
+ *
+ * @details
+ * Procura em largura sncrona por nveis, com otimizao de direo (Beamer et al.):
+ * - de cima para baixo: cada thread percorre uma parte da fronteira e reclama os
+ *   vizinhos por visitar com compare-and-swap em `distancias`, pelo que cada vrtice
+ *   entra na fronteira seguinte uma nica vez;
+ * - de baixo para cima: cada thread percorre uma faixa de vrtices por visitar e pra
+ *   no primeiro vizinho que esteja na fronteira. Cada vrtice s  escrito pela thread
+ *   da sua faixa, pelo que no h operaes atmicas sobre `distancias`.
+ *
+ * A passagem para baixo para cima d-se quando as arestas da fronteira (mf) passam de
+ * 1/ALFA das arestas dos vrtices por visitar (mu); o regresso, quando a fronteira
+ * encolhe para menos de 1/BETA dos vrtices. Em cada nvel, as threads juntam os
+ * vrtices descobertos num buffer local e reservam espao na fronteira seguinte com
+ * uma nica soma atmica por buffer. Os nveis pequenos correm s na thread que chama,
+ * pois no compensam o custo de lanar threads.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "Structs.h"
+#include "FuncoesBuscaParalela.h"
+#include "FuncoesThreads.h"
+
+#define ALFA_DIRECAO 14
+#define BETA_DIRECAO 24
+#define TRABALHO_MINIMO_POR_THREAD (1 << 14)    // arestas (ou vrtices) por thread em cada nvel
+#define TAMANHO_BUFFER_FRONTEIRA 256
+
+/**
+ * @brief Estado partilhado pelas threads de um nvel da procura.
+ */
+typedef struct LarguraParalela {
+    const GrafoCSR* csr;         /**< Grafo a percorrer */
+    int* distancias;             /**< Distncia de cada vrtice (-1 se por visitar) */
+    int* pais;                   /**< Antecessor de cada vrtice, ou NULL */
+    int* marcaNivel;             /**< Nvel em que cada vrtice esteve na fronteira (de baixo para cima) */
+    const int* fronteira;        /**< Vrtices do nvel atual */
+    int tamanhoFronteira;        /**< Nmero de vrtices do nvel atual */
+    int* proxima;                /**< Vrtices do nvel seguinte */
+    volatile int tamanhoProxima; /**< Nmero de vrtices do nvel seguinte */
+    int nivel;                   /**< Distncia dos vrtices da fronteira */
+    long long* grauThread;       /**< Soma dos graus dos vrtices descobertos por cada thread */
+} LarguraParalela;
+
+/**
+ * @brief Buffer local de uma thread com vrtices descobertos.
+ */
+typedef struct BufferFronteira {
+    int vertices[TAMANHO_BUFFER_FRONTEIRA];
+    int tamanho;
+} BufferFronteira;
+
+/**
+ * @brief Copia o buffer para a fronteira seguinte, reservando o espao com uma soma atmica.
+ */
+static void despejarBuffer(LarguraParalela* l, BufferFronteira* b) {
+    if (b->tamanho == 0) return;
+    int posicao = somarAtomicoInteiro(&l->tamanhoProxima, b->tamanho);
+    memcpy(l->proxima + posicao, b->vertices, (size_t)b->tamanho * sizeof(int));
+    b->tamanho = 0;
+}
+
+/**
+ * @brief Acrescenta um vrtice descoberto ao buffer da thread.
+ */
+static void acrescentarBuffer(LarguraParalela* l, BufferFronteira* b, int v) {
+    b->vertices[b->tamanho++] = v;
+    if (b->tamanho == TAMANHO_BUFFER_FRONTEIRA) despejarBuffer(l, b);
+}
+
+/**
+ * @brief Nvel de cima para baixo: a parte `indiceThread` da fronteira reclama os vizinhos por visitar.
+ */
+static void nivelDeCimaParaBaixo(void* dados, int indiceThread, int numThreads) {
+    LarguraParalela* l = dados;
+    const GrafoCSR* csr = l->csr;
+    int inicio = (int)((long long)l->tamanhoFronteira * indiceThread / numThreads);
+    int fim = (int)((long long)l->tamanhoFronteira * (indiceThread + 1) / numThreads);
+    int proximoNivel = l->nivel + 1;
+    long long grau = 0;
+    BufferFronteira b;
+    b.tamanho = 0;
+
+    for (int i = inicio; i < fim; i++) {
+        int v = l->fronteira[i];
+        for (int e = csr->offsets[v]; e < csr->offsets[v + 1]; e++) {
+            int w = csr->destinos[e];
+            int reclamado;
+            if (numThreads == 1) {  // sozinha neste nvel: no precisa de operaes atmicas
+                reclamado = l->distancias[w] < 0;
+                if (reclamado) l->distancias[w] = proximoNivel;
+            }
+            else {
+                volatile int* d = (volatile int*)&l->distancias[w];
+                reclamado = lerAtomicoInteiro(d) < 0 && compararETrocarInteiro(d, -1, proximoNivel);
+            }
+            if (reclamado) {
+                if (l->pais) l->pais[w] = v;
+                grau += csr->offsets[w + 1] - csr->offsets[w];
+                acrescentarBuffer(l, &b, w);
+            }
+        }
+    }
+    despejarBuffer(l, &b);
+    l->grauThread[indiceThread] = grau;
+}
+
+/**
+ * @brief Nvel de baixo para cima: cada vrtice por visitar da faixa `indiceThread`
+ * procura um vizinho na fronteira.
+ */
+static void nivelDeBaixoParaCima(void* dados, int indiceThread, int numThreads) {
+    LarguraParalela* l = dados;
+    const GrafoCSR* csr = l->csr;
+    int inicio = (int)((long long)csr->numVertices * indiceThread / numThreads);
+    int fim = (int)((long long)csr->numVertices * (indiceThread + 1) / numThreads);
+    long long grau = 0;
+    BufferFronteira b;
+    b.tamanho = 0;
+
+    for (int v = inicio; v < fim; v++) {
+        if (l->distancias[v] >= 0) continue;
+        for (int e = csr->offsets[v]; e < csr->offsets[v + 1]; e++) {
+            int w = csr->destinos[e];
+            if (l->marcaNivel[w] == l->nivel) {
+                l->distancias[v] = l->nivel + 1;
+                if (l->pais) l->pais[v] = w;
+                grau += csr->offsets[v + 1] - csr->offsets[v];
+                acrescentarBuffer(l, &b, v);
+                break;
+            }
+        }
+    }
+    despejarBuffer(l, &b);
+    l->grauThread[indiceThread] = grau;
+}
+
+/**
+ * @brief Nmero de threads para um nvel com `trabalho` unidades (arestas ou vrtices).
+ */
+static int threadsParaNivel(long long trabalho, long long trabalhoMinimo, int numThreads) {
+    long long n = trabalho / trabalhoMinimo;
+    if (n < 1) return 1;
+    return n < numThreads ? (int)n : numThreads;
+}
+
+/**
+ * @brief Procura em largura paralela com otimizao de direo.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @param origem ndice denso do vrtice inicial.
+ * @param distancias Vetor de `numVertices` distncias a preencher.
+ * @param pais Vetor de `numVertices` antecessores a preencher, ou NULL.
+ * @param numThreads Nmero de threads (se <= 0, usa o nmero de processadores).
+ * @param opcoes Afinao da procura, ou NULL.
+ * @return Nmero de vrtices alcanados, -1 se parmetros invlidos, -2 se faltar memria.
+ */
+int procurarEmLarguraCSRParalelaOpcoes(const GrafoCSR* csr, int origem, int* distancias, int* pais, int numThreads,
+    const OpcoesLargura* opcoes) {
+    if (!csr || !distancias || origem < 0 || origem >= csr->numVertices) return -1;
+    if (numThreads <= 0) numThreads = numeroProcessadores();
+    long long trabalhoMinimo = opcoes && opcoes->trabalhoMinimo > 0 ? opcoes->trabalhoMinimo : TRABALHO_MINIMO_POR_THREAD;
+    int direcao = opcoes ? opcoes->direcao : DIRECAO_AUTOMATICA;
+
+    int n = csr->numVertices;
+    int* fronteira = malloc((size_t)n * sizeof(int));
+    int* proxima = malloc((size_t)n * sizeof(int));
+    long long* grauThread = malloc((size_t)numThreads * sizeof(long long));
+    if (!fronteira || !proxima || !grauThread) {
+        free(fronteira);
+        free(proxima);
+        free(grauThread);
+        return -2;
+    }
+
+    for (int v = 0; v < n; v++) distancias[v] = -1;
+    distancias[origem] = 0;
+    if (pais) pais[origem] = -1;
+    fronteira[0] = origem;
+
+    LarguraParalela l;
+    l.csr = csr;
+    l.distancias = distancias;
+    l.pais = pais;
+    l.marcaNivel = NULL;          // s alocado se a procura passar a baixo para cima
+    l.grauThread = grauThread;
+
+    int tamanhoFronteira = 1, alcancados = 1, baixoParaCima = 0;
+    long long arestasFronteira = csr->offsets[origem + 1] - csr->offsets[origem];   // mf
+    long long arestasPorVisitar = (long long)csr->numArestas - arestasFronteira;     // mu
+
+    for (int nivel = 0; tamanhoFronteira > 0; nivel++) {
+        int querBaixoParaCima;
+        if (direcao == DIRECAO_CIMA_PARA_BAIXO) querBaixoParaCima = 0;
+        else if (direcao == DIRECAO_BAIXO_PARA_CIMA) querBaixoParaCima = 1;
+        else if (!baixoParaCima) querBaixoParaCima = arestasFronteira > arestasPorVisitar / ALFA_DIRECAO;
+        else querBaixoParaCima = tamanhoFronteira >= n / BETA_DIRECAO;
+
+        if (querBaixoParaCima && !l.marcaNivel) {
+            l.marcaNivel = malloc((size_t)n * sizeof(int));
+            if (l.marcaNivel) {
+                for (int v = 0; v < n; v++) l.marcaNivel[v] = -1;
+            }
+        }
+        baixoParaCima = querBaixoParaCima && l.marcaNivel != NULL;  // sem memria, continua de cima para baixo
+
+        l.fronteira = fronteira;
+        l.tamanhoFronteira = tamanhoFronteira;
+        l.proxima = proxima;
+        l.tamanhoProxima = 0;
+        l.nivel = nivel;
+
+        int threads;
+        if (baixoParaCima) {
+            for (int i = 0; i < tamanhoFronteira; i++) l.marcaNivel[fronteira[i]] = nivel;
+            threads = threadsParaNivel(n, trabalhoMinimo, numThreads);
+            executarEmParalelo(nivelDeBaixoParaCima, &l, threads);
+        }
+        else {
+            threads = threadsParaNivel(arestasFronteira, trabalhoMinimo, numThreads);
+            executarEmParalelo(nivelDeCimaParaBaixo, &l, threads);
+        }
+
+        arestasFronteira = 0;
+        for (int t = 0; t < threads; t++) arestasFronteira += grauThread[t];
+        arestasPorVisitar -= arestasFronteira;
+
+        int* troca = fronteira;
+        fronteira = proxima;
+        proxima = troca;
+        tamanhoFronteira = l.tamanhoProxima;
+        alcancados += tamanhoFronteira;
+    }
+
+    free(l.marcaNivel);
+    free(fronteira);
+    free(proxima);
+    free(grauThread);
+    return alcancados;
+}
+
+/**
+ * @brief Procura em largura paralela com otimizao de direo e a afinao por omisso.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @param origem ndice denso do vrtice inicial.
+ * @param distancias Vetor de `numVertices` distncias a preencher.
+ * @param pais Vetor de `numVertices` antecessores a preencher, ou NULL.
+ * @param numThreads Nmero de threads (se <= 0, usa o nmero de processadores).
+ * @return Nmero de vrtices alcanados, -1 se parmetros invlidos, -2 se faltar memria.
+ */
+int procurarEmLarguraCSRParalela(const GrafoCSR* csr, int origem, int* distancias, int* pais, int numThreads) {
+    return procurarEmLarguraCSRParalelaOpcoes(csr, origem, distancias, pais, numThreads, NULL);
+}
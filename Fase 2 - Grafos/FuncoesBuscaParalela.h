@@ -0,0 +1,60 @@
+#ifndef FUNCOESBUSCAPARALELA_H
+#define FUNCOESBUSCAPARALELA_H
+
+/**
+ * @file FuncoesBuscaParalela.h
+ * @brief Declarao das procuras paralelas sobre o grafo CSR.
+ *
+ * A procura em largura avana um nvel de cada vez, repartindo o nvel pelas threads.
+ * Quando a fronteira  grande, passa de "cima para baixo" (a fronteira procura os
+ * vizinhos por visitar) para "baixo para cima" (os vrtices por visitar procuram um
+ * vizinho na fronteira), que examina muito menos arestas nesses nveis.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "Structs.h"
+
+#define DIRECAO_AUTOMATICA 0        // Sentido escolhido em cada nvel pelo tamanho da fronteira
+#define DIRECAO_CIMA_PARA_BAIXO 1   // Todos os nveis de cima para baixo
+#define DIRECAO_BAIXO_PARA_CIMA 2   // Todos os nveis de baixo para cima
+
+ /**
+  * @brief Procura em largura paralela sobre o grafo CSR, com distncias e antecessores.
+  *
+  * As distncias so as mesmas de uma procura em largura sequencial. Quando um vrtice
+  * tem vrios antecessores possveis no nvel anterior, o escolhido depende das threads.
+  * As arestas devem ser simtricas (como as criadas por `criarArestasAdjacentes`), pois
+  * o modo "de baixo para cima" percorre as arestas no sentido contrrio.
+  *
+  * @param csr Apontador para o grafo CSR.
+  * @param origem ndice denso do vrtice inicial.
+  * @param distancias Vetor com `numVertices` posies: nmero de arestas desde a origem (-1 se no alcanado).
+  * @param pais Vetor com `numVertices` posies para o antecessor (ndice denso, -1 na origem), ou NULL.
+  * @param numThreads Nmero de threads (se <= 0, usa o nmero de processadores).
+  * @return Nmero de vrtices alcanados, -1 se parmetros invlidos, -2 se faltar memria.
+  */
+int procurarEmLarguraCSRParalela(const GrafoCSR* csr, int origem, int* distancias, int* pais, int numThreads);
+
+/**
+ * @brief Verso de `procurarEmLarguraCSRParalela` com a afinao indicada.
+ *
+ * Um nvel s  repartido pelas threads se tiver pelo menos `opcoes->trabalhoMinimo`
+ * arestas (de cima para baixo) ou vrtices (de baixo para cima) por thread, e
+ * `opcoes->direcao` pode fixar o sentido de todos os nveis. Com um trabalho mnimo de 1,
+ * mesmo um grafo pequeno  repartido pelas threads, o que serve para verificar a procura.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @param origem ndice denso do vrtice inicial.
+ * @param distancias Vetor com `numVertices` posies para as distncias.
+ * @param pais Vetor com `numVertices` posies para os antecessores, ou NULL.
+ * @param numThreads Nmero de threads (se <= 0, usa o nmero de processadores).
+ * @param opcoes Afinao da procura (NULL = valores por omisso).
+ * @return Nmero de vrtices alcanados, -1 se parmetros invlidos, -2 se faltar memria.
+ */
+int procurarEmLarguraCSRParalelaOpcoes(const GrafoCSR* csr, int origem, int* distancias, int* pais, int numThreads,
+    const OpcoesLargura* opcoes);
+
+#endif // FUNCOESBUSCAPARALELA_H
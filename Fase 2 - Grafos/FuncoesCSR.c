@@ -0,0 +1,446 @@
+/**
+ * @file FuncoesCSR.c
+ * @brief Representao compacta (CSR) do grafo e procuras sobre ela.
+ *
+ * @details
+ * No grafo ligado, cada aresta  uma alocao separada e as procuras saltam de
+ * apontador em apontador (`adj` -> `next` -> `destino`), o que provoca falhas de cache
+ * constantes. A representao CSR guarda, num nico bloco de memria:
+ * - os dados de cada vrtice, por ndice denso;
+ * - o incio das arestas de cada vrtice (`offsets`);
+ * - o ndice denso do destino e o peso de cada aresta, em vetores contguos.
+ *
+ * A cpia  s de leitura: alteraes posteriores ao grafo original exigem
+ * congelar o grafo novamente. Como o bloco no contm apontadores, pode ser escrito
+ * tal como est num ficheiro e mapeado de volta (ver FuncoesBinario.c).
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Structs.h"
+#include "FuncoesCSR.h"
+#include "FuncoesGrafo.h"
+#include "FuncoesIndice.h"
+#include "FuncoesMemoria.h"
+#include "FuncoesFicheiro.h"
+
+/**
+ * @brief Calcula o tamanho do bloco que guarda todos os vetores de um grafo CSR.
+ *
+ * @param numVertices Nmero de vrtices.
+ * @param numArestas Nmero de arestas dirigidas.
+ * @param maxId Maior ID de vrtice.
+ * @return Tamanho do bloco em bytes.
+ */
+size_t tamanhoBlocoCSR(int numVertices, int numArestas, int maxId) {
+    return (size_t)numVertices * sizeof(VerticeCSR)
+        + ((size_t)numVertices + 1) * sizeof(int)
+        + (size_t)numArestas * sizeof(int)
+        + (size_t)numArestas * sizeof(float)
+        + ((size_t)maxId + 1) * sizeof(int);
+}
+
+/**
+ * @brief Aponta os vetores do grafo CSR para as respetivas zonas do bloco.
+ *
+ * @param csr Grafo CSR com `numVertices`, `numArestas`, `maxId` e `bloco` preenchidos.
+ */
+void distribuirBlocoCSR(GrafoCSR* csr) {
+    char* p = csr->bloco;
+    csr->vertices = (VerticeCSR*)p;
+    p += (size_t)csr->numVertices * sizeof(VerticeCSR);
+    csr->offsets = (int*)p;
+    p += ((size_t)csr->numVertices + 1) * sizeof(int);
+    csr->destinos = (int*)p;
+    p += (size_t)csr->numArestas * sizeof(int);
+    csr->pesos = (float*)p;
+    p += (size_t)csr->numArestas * sizeof(float);
+    csr->indicePorId = (int*)p;
+}
+
+/**
+ * @brief Verifica se os vetores de um grafo CSR so consistentes entre si.
+ *
+ * Primeiro verifica todos os `offsets` (comeam em 0, nunca diminuem e nunca passam de
+ * `numArestas`) e s depois l os destinos, pelo que um ficheiro corrompido no leva a
+ * ler fora de `destinos`. Por fim, verifica os IDs e a tabela `indicePorId`.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @return 0 se vlido, -1 se o grafo for NULL, -2 se os `offsets` forem invlidos,
+ *         -3 se algum destino estiver fora dos vrtices, -4 se algum ID ou a tabela
+ *         `indicePorId` forem invlidos.
+ */
+int validarGrafoCSR(const GrafoCSR* csr) {
+    if (!csr) return -1;
+    int n = csr->numVertices;
+    if (csr->offsets[0] != 0 || csr->offsets[n] != csr->numArestas) return -2;
+    for (int i = 0; i < n; i++) {
+        if (csr->offsets[i + 1] < csr->offsets[i] || csr->offsets[i + 1] > csr->numArestas) return -2;
+    }
+
+    // com os offsets vlidos, as arestas de todos os vrtices so exatamente destinos[0 .. numArestas-1]
+    for (int e = 0; e < csr->numArestas; e++) {
+        if (csr->destinos[e] < 0 || csr->destinos[e] >= n) return -3;
+    }
+
+    for (int i = 0; i < n; i++) {
+        int id = csr->vertices[i].id;
+        if (id < 0 || id > csr->maxId) return -4;
+    }
+    for (int id = 0; id <= csr->maxId; id++) {
+        int i = csr->indicePorId[id];
+        if (i < -1 || i >= n || (i >= 0 && csr->vertices[i].id != id)) return -4;
+    }
+    for (int i = 0; i < n; i++) {  // IDs repetidos: s um dos vrtices est na tabela
+        if (csr->indicePorId[csr->vertices[i].id] != i) return -4;
+    }
+    return 0;
+}
+
+/**
+ * @brief Cria a cpia compacta de um grafo.
+ *
+ * Faz duas passagens pela lista de vrtices: a primeira conta arestas e determina o
+ * maior ID, a segunda preenche os vetores. Os destinos so convertidos em ndices
+ * densos atravs da tabela `indicePorId`. O bloco  inicializado a zeros para que
+ * o enchimento das estruturas tambm seja determinstico quando gravado em ficheiro.
+ *
+ * @param grafo Apontador para o grafo a congelar.
+ * @return Apontador para o grafo CSR, ou NULL se o grafo for invlido ou faltar memria.
+ */
+GrafoCSR* congelarGrafo(GR* grafo) {
+    if (!grafo) return NULL;
+
+    int numVertices = 0, numArestas = 0, maxId = -1;
+    for (Vertice* v = grafo->vertices; v != NULL; v = v->next) {
+        numVertices++;
+        if (v->id > maxId) maxId = v->id;
+        for (Aresta* a = v->adj; a != NULL; a = a->next) {
+            numArestas++;
+        }
+    }
+
+    GrafoCSR* csr = malloc(sizeof(GrafoCSR));
+    if (!csr) return NULL;
+    csr->numVertices = numVertices;
+    csr->numArestas = numArestas;
+    csr->linhas = grafo->linhas;
+    csr->colunas = grafo->colunas;
+    csr->maxId = maxId;
+    size_t tamanho = tamanhoBlocoCSR(numVertices, numArestas, maxId);
+    csr->bloco = calloc(1, tamanho > 0 ? tamanho : 1);
+    if (!csr->bloco) {
+        free(csr);
+        return NULL;
+    }
+    csr->ficheiro.dados = NULL;
+    csr->ficheiro.tamanho = 0;
+    csr->ficheiro.mapeado = 0;
+    distribuirBlocoCSR(csr);
+
+    for (int i = 0; i <= maxId; i++) {
+        csr->indicePorId[i] = -1;
+    }
+    int i = 0;
+    for (Vertice* v = grafo->vertices; v != NULL; v = v->next, i++) {
+        csr->vertices[i].id = v->id;
+        csr->vertices[i].x = v->x;
+        csr->vertices[i].y = v->y;
+        csr->vertices[i].frequencia = v->frequencia;
+        csr->indicePorId[v->id] = i;
+    }
+
+    int e = 0;
+    i = 0;
+    for (Vertice* v = grafo->vertices; v != NULL; v = v->next, i++) {
+        csr->offsets[i] = e;
+        for (Aresta* a = v->adj; a != NULL; a = a->next, e++) {
+            csr->destinos[e] = csr->indicePorId[a->destino->id];
+            csr->pesos[e] = a->peso;
+        }
+    }
+    csr->offsets[numVertices] = e;
+
+    return csr;
+}
+
+/**
+ * @brief Reconstri um grafo ligado a partir de um grafo CSR.
+ *
+ * Os vrtices e as arestas so obtidos de uma s vez como vetores contguos dos pools
+ * do novo grafo, em vez de um elemento de cada vez, e os ndices so reservados para o
+ * tamanho final antes de serem preenchidos. A ordem dos vrtices e das listas de
+ * adjacncia  a do grafo CSR, pelo que as procuras do os mesmos resultados.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @return Apontador para o novo grafo, ou NULL se o grafo CSR for invlido ou faltar memria.
+ */
+GR* descongelarGrafo(const GrafoCSR* csr) {
+    if (!csr) return NULL;
+
+    GR* grafo = criarGrafo();
+    if (!grafo) return NULL;
+    grafo->linhas = csr->linhas;
+    grafo->colunas = csr->colunas;
+    if (csr->numVertices == 0) return grafo;
+
+    Vertice* vertices = alocarVetorDoPool(&grafo->poolVertices, (size_t)csr->numVertices);
+    Aresta* arestas = csr->numArestas > 0 ? alocarVetorDoPool(&grafo->poolArestas, (size_t)csr->numArestas) : NULL;
+    if (!vertices || (csr->numArestas > 0 && !arestas) ||
+        reservarIndiceCoordenadas(grafo, csr->numVertices) != 0 ||
+        reservarIndiceIds(grafo, csr->maxId) != 0 ||
+        reservarIndiceDenso(grafo, csr->numVertices) != 0) {
+        libertarGrafo(grafo);
+        return NULL;
+    }
+
+    for (int i = 0; i < csr->numVertices; i++) {
+        Vertice* v = &vertices[i];
+        v->id = csr->vertices[i].id;
+        v->frequencia = csr->vertices[i].frequencia;
+        v->x = csr->vertices[i].x;
+        v->y = csr->vertices[i].y;
+        v->visitado = 0;
+        v->indice = i;
+        v->adj = NULL;
+        v->prev = i > 0 ? v - 1 : NULL;
+        v->next = i + 1 < csr->numVertices ? v + 1 : NULL;
+
+        for (int e = csr->offsets[i + 1] - 1; e >= csr->offsets[i]; e--) {  // de trs para a frente: mantm a ordem
+            arestas[e].destino = &vertices[csr->destinos[e]];
+            arestas[e].peso = csr->pesos[e];
+            arestas[e].next = v->adj;
+            v->adj = &arestas[e];
+        }
+
+        if (indexarCoordenadas(grafo, v) != 0 || indexarId(grafo, v) != 0) {
+            libertarGrafo(grafo);
+            return NULL;
+        }
+        grafo->porIndice[i] = v;
+    }
+
+    grafo->vertices = &vertices[0];
+    grafo->ultimo = &vertices[csr->numVertices - 1];
+    grafo->numVertices = csr->numVertices;
+    grafo->versao++;  // vrtices e arestas criados sem passar por adicionarVertice
+    return grafo;
+}
+
+/**
+ * @brief Liberta o bloco de vetores e a estrutura do grafo CSR.
+ *
+ * Se o bloco foi mapeado de um ficheiro binrio, o ficheiro  desmapeado em vez de libertado.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @return 0 se for bem sucedido, -1 se o grafo for NULL.
+ */
+int libertarGrafoCSR(GrafoCSR* csr) {
+    if (!csr) return -1;
+    if (csr->ficheiro.dados) {
+        desmapearFicheiro(&csr->ficheiro);
+    }
+    else {
+        free(csr->bloco);
+    }
+    free(csr);
+    return 0;
+}
+
+/**
+ * @brief Converte um ID de vrtice no seu ndice denso.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @param id ID do vrtice.
+ * @return ndice denso, ou -1 se o ID no existir.
+ */
+int indiceCSRPorId(const GrafoCSR* csr, int id) {
+    if (!csr || id < 0 || id > csr->maxId) return -1;
+    return csr->indicePorId[id];
+}
+
+/**
+ * @brief Imprime os dados de um vrtice do grafo CSR, no mesmo formato de `imprimirVertice`.
+ */
+static void imprimirVerticeCSR(const VerticeCSR* v) {
+    printf("ID: %d  Freq: %c  Coord: (%d,%d)\n", v->id, v->frequencia, v->x, v->y);
+}
+
+/**
+ * @brief Percurso em profundidade sobre o grafo CSR.
+ *
+ * Usa uma pilha explcita onde cada posio guarda o vrtice e o cursor da prxima
+ * aresta a examinar, pelo que cada aresta  vista uma nica vez e a profundidade
+ * no est limitada pela pilha de chamadas.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @param origem ndice denso do vrtice inicial.
+ * @return Nmero total de vrtices visitados, ou 0 se os parmetros forem invlidos.
+ */
+int dftCSR(const GrafoCSR* csr, int origem) {
+    if (!csr || origem < 0 || origem >= csr->numVertices) return 0;
+
+    char* visitado = calloc((size_t)csr->numVertices, sizeof(char));
+    int* pilha = malloc((size_t)csr->numVertices * sizeof(int));
+    int* cursor = malloc((size_t)csr->numVertices * sizeof(int));
+    if (!visitado || !pilha || !cursor) {
+        free(visitado);
+        free(pilha);
+        free(cursor);
+        return 0;
+    }
+
+    int count = 1, topo = 0;
+    visitado[origem] = 1;
+    imprimirVerticeCSR(&csr->vertices[origem]);
+    pilha[topo] = origem;
+    cursor[topo] = csr->offsets[origem];
+    topo++;
+
+    while (topo > 0) {
+        int v = pilha[topo - 1];
+        if (cursor[topo - 1] < csr->offsets[v + 1]) {
+            int w = csr->destinos[cursor[topo - 1]++];
+            if (!visitado[w]) {
+                visitado[w] = 1;
+                imprimirVerticeCSR(&csr->vertices[w]);
+                count++;
+                pilha[topo] = w;
+                cursor[topo] = csr->offsets[w];
+                topo++;
+            }
+        }
+        else {
+            topo--;
+        }
+    }
+
+    free(visitado);
+    free(pilha);
+    free(cursor);
+    return count;
+}
+
+/**
+ * @brief Percurso em largura sobre o grafo CSR.
+ *
+ * A fila tem uma posio por vrtice, pois cada vrtice entra na fila no mximo uma vez.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @param origem ndice denso do vrtice inicial.
+ * @return Nmero total de vrtices visitados, ou 0 se os parmetros forem invlidos.
+ */
+int bftCSR(const GrafoCSR* csr, int origem) {
+    if (!csr || origem < 0 || origem >= csr->numVertices) return 0;
+
+    char* visitado = calloc((size_t)csr->numVertices, sizeof(char));
+    int* fila = malloc((size_t)csr->numVertices * sizeof(int));
+    if (!visitado || !fila) {
+        free(visitado);
+        free(fila);
+        return 0;
+    }
+
+    int inicioFila = 0, fimFila = 0;
+    visitado[origem] = 1;
+    fila[fimFila++] = origem;
+
+    while (inicioFila < fimFila) {
+        int v = fila[inicioFila++];
+        imprimirVerticeCSR(&csr->vertices[v]);
+
+        for (int e = csr->offsets[v]; e < csr->offsets[v + 1]; e++) {
+            int w = csr->destinos[e];
+            if (!visitado[w]) {
+                visitado[w] = 1;
+                fila[fimFila++] = w;
+            }
+        }
+    }
+
+    free(visitado);
+    free(fila);
+    return fimFila;
+}
+
+/**
+ * @brief Imprime um caminho de ndices densos, no mesmo formato de `imprimirCaminho`.
+ */
+static void imprimirCaminhoCSR(const GrafoCSR* csr, const int* caminho, int tamanho) {
+    for (int i = 0; i < tamanho; i++) {
+        printf("ID: %d (%c) -> ", csr->vertices[caminho[i]].id, csr->vertices[caminho[i]].frequencia);
+    }
+    printf("FIM\n");
+}
+
+/**
+ * @brief Encontra e imprime todos os caminhos simples entre dois vrtices do grafo CSR.
+ *
+ * Equivalente a `encontrarTodosCaminhos`, mas com uma pilha explcita (vrtice + cursor
+ * de aresta) em vez de recurso. O caminho atual  o prprio contedo da pilha.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @param origem ndice denso do vrtice de origem.
+ * @param destino ndice denso do vrtice de destino.
+ * @return Nmero total de caminhos encontrados, ou 0 se os parmetros forem invlidos.
+ */
+int encontrarTodosCaminhosCSR(const GrafoCSR* csr, int origem, int destino) {
+    if (!csr || origem < 0 || origem >= csr->numVertices ||
+        destino < 0 || destino >= csr->numVertices) return 0;
+
+    char* visitado = calloc((size_t)csr->numVertices, sizeof(char));
+    int* pilha = malloc((size_t)csr->numVertices * sizeof(int));
+    int* cursor = malloc((size_t)csr->numVertices * sizeof(int));
+    if (!visitado || !pilha || !cursor) {
+        free(visitado);
+        free(pilha);
+        free(cursor);
+        return 0;
+    }
+
+    int totalCaminhos = 0, topo = 0;
+    pilha[topo] = origem;
+    cursor[topo] = csr->offsets[origem];
+    topo++;
+
+    if (origem == destino) {
+        imprimirCaminhoCSR(csr, pilha, topo);
+        totalCaminhos = 1;
+        topo = 0;
+    }
+    else {
+        visitado[origem] = 1;
+    }
+
+    while (topo > 0) {
+        int v = pilha[topo - 1];
+        if (cursor[topo - 1] < csr->offsets[v + 1]) {
+            int w = csr->destinos[cursor[topo - 1]++];
+            if (visitado[w]) continue;
+
+            pilha[topo] = w;
+            if (w == destino) {
+                imprimirCaminhoCSR(csr, pilha, topo + 1);
+                totalCaminhos++;
+            }
+            else {
+                visitado[w] = 1;
+                cursor[topo] = csr->offsets[w];
+                topo++;
+            }
+        }
+        else {
+            visitado[v] = 0;
+            topo--;
+        }
+    }
+
+    free(visitado);
+    free(pilha);
+    free(cursor);
+    return totalCaminhos;
+}
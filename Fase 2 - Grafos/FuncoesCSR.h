@@ -0,0 +1,117 @@
+#ifndef FUNCOESCSR_H
+#define FUNCOESCSR_H
+
+/**
+ * @file FuncoesCSR.h
+ * @brief Declarao das funes sobre a representao compacta (CSR) do grafo.
+ *
+ * Permite "congelar" um grafo construdo numa cpia s de leitura, com vrtices,
+ * destinos e pesos em vetores contguos, e executar procuras sobre essa cpia.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "Structs.h"
+
+ /**
+  * @brief Cria uma cpia compacta (CSR) de um grafo.
+  *
+  * Os vrtices recebem ndices densos pela ordem da lista do grafo e as arestas de cada
+  * vrtice mantm a ordem da lista de adjacncia. O grafo original no  alterado.
+  *
+  * @param grafo Apontador para o grafo a congelar.
+  * @return Apontador para o grafo CSR criado ou NULL em caso de erro.
+  */
+GrafoCSR* congelarGrafo(GR* grafo);
+
+/**
+ * @brief Cria um grafo ligado com os mesmos vrtices e arestas de um grafo CSR.
+ *
+ * O grafo CSR tem de ser vlido (ver `validarGrafoCSR`); `carregarGrafoCSRBinario` s
+ * devolve grafos que passaram essa verificao.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @return Apontador para o novo grafo ou NULL em caso de erro.
+ */
+GR* descongelarGrafo(const GrafoCSR* csr);
+
+/**
+ * @brief Calcula o tamanho do bloco que guarda todos os vetores de um grafo CSR.
+ *
+ * @param numVertices Nmero de vrtices.
+ * @param numArestas Nmero de arestas dirigidas.
+ * @param maxId Maior ID de vrtice.
+ * @return Tamanho do bloco em bytes.
+ */
+size_t tamanhoBlocoCSR(int numVertices, int numArestas, int maxId);
+
+/**
+ * @brief Aponta os vetores do grafo CSR para as respetivas zonas do bloco.
+ *
+ * @param csr Grafo CSR com `numVertices`, `numArestas`, `maxId` e `bloco` preenchidos.
+ */
+void distribuirBlocoCSR(GrafoCSR* csr);
+
+/**
+ * @brief Verifica se os vetores de um grafo CSR so consistentes entre si.
+ *
+ * Deve ser usada antes de confiar num grafo que no foi criado por `congelarGrafo`
+ * (por exemplo, lido de um ficheiro), porque as procuras e `descongelarGrafo` usam os
+ * vetores como ndices sem os verificar.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @return 0 se vlido, -1 se o grafo for NULL, -2 se os `offsets` forem invlidos,
+ *         -3 se algum destino estiver fora dos vrtices, -4 se algum ID ou a tabela
+ *         `indicePorId` forem invlidos.
+ */
+int validarGrafoCSR(const GrafoCSR* csr);
+
+/**
+ * @brief Liberta toda a memria de um grafo CSR.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @return 0 em sucesso, -1 se o grafo for NULL.
+ */
+int libertarGrafoCSR(GrafoCSR* csr);
+
+/**
+ * @brief Devolve o ndice denso do vrtice com um dado ID.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @param id ID do vrtice.
+ * @return ndice denso do vrtice ou -1 se no existir.
+ */
+int indiceCSRPorId(const GrafoCSR* csr, int id);
+
+/**
+ * @brief Procura em profundidade sobre o grafo CSR, imprimindo os vrtices visitados.
+ * Visita os vrtices pela mesma ordem que `dft` no grafo original.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @param origem ndice denso do vrtice inicial.
+ * @return int Nmero de vrtices visitados.
+ */
+int dftCSR(const GrafoCSR* csr, int origem);
+
+/**
+ * @brief Procura em largura sobre o grafo CSR, imprimindo os vrtices visitados.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @param origem ndice denso do vrtice inicial.
+ * @return int Nmero de vrtices visitados.
+ */
+int bftCSR(const GrafoCSR* csr, int origem);
+
+/**
+ * @brief Encontra e imprime todos os caminhos entre dois vrtices do grafo CSR.
+ *
+ * @param csr Apontador para o grafo CSR.
+ * @param origem ndice denso do vrtice de origem.
+ * @param destino ndice denso do vrtice de destino.
+ * @return int Nmero total de caminhos encontrados.
+ */
+int encontrarTodosCaminhosCSR(const GrafoCSR* csr, int origem, int destino);
+
+#endif // FUNCOESCSR_H
@@ -0,0 +1,235 @@
+/**
+ * @file FuncoesCaminhoMinimo.c
+ * @brief Implementao das procuras de caminho mais curto (Dijkstra e A*).
+ *
+ * @details
+ * Dijkstra e A* partilham o mesmo ciclo: a diferena est s na estimativa somada ao
+ * custo de cada vrtice na fila de prioridade (0 em Dijkstra, a distncia octil at ao
+ * destino em A*). O estado de cada vrtice vem do contexto, sem tocar nos vrtices:
+ * - no marcado na poca atual: ainda no alcanado;
+ * - marcado e com posio no heap: aberto (custo provisrio);
+ * - marcado e fora do heap: fechado (custo final).
+ *
+ * Em chaves iguais sai primeiro o vrtice com maior custo desde a origem, isto , o
+ * mais prximo do destino, o que evita expandir os empates todos num mapa uniforme.
+ * Os pesos 1.0f e 1.414f tm 24 bits de mantissa, pelo que as somas em double (custos
+ * e distncia octil) so exatas: os empates so empates de facto e a heurstica nunca
+ * excede o custo real por erro de arredondamento.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "Structs.h"
+#include "FuncoesCaminhoMinimo.h"
+#include "FuncoesContexto.h"
+#include "FuncoesHeap.h"
+#include "FuncoesIndice.h"
+
+#define PESO_ORTOGONAL 1.0
+#define PESO_DIAGONAL ((double)1.414f)   // o mesmo valor (em float) das arestas diagonais
+
+/**
+ * @brief Distncia octil: diagonais enquanto possvel, depois em linha reta.
+ *
+ * @param dx Diferena entre as coordenadas x.
+ * @param dy Diferena entre as coordenadas y.
+ * @return Custo mnimo de um caminho em grelha com essas diferenas.
+ */
+double distanciaOctil(int dx, int dy) {
+    if (dx < 0) dx = -dx;
+    if (dy < 0) dy = -dy;
+    int menor = dx < dy ? dx : dy;
+    int maior = dx < dy ? dy : dx;
+    return (maior - menor) * PESO_ORTOGONAL + menor * PESO_DIAGONAL;
+}
+
+/**
+ * @brief Heurstica de A*: distncia octil at ao destino (`dados`).
+ *
+ * @param v Vrtice a estimar.
+ * @param dados Apontador para o vrtice de destino.
+ * @return Distncia octil de `v` ao destino.
+ */
+double heuristicaOctil(const Vertice* v, const void* dados) {
+    const Vertice* destino = dados;
+    return distanciaOctil(v->x - destino->x, v->y - destino->y);
+}
+
+/**
+ * @brief Relaxa `w` a partir do vrtice expandido `v`, com o custo `custo` at `w`.
+ *
+ * Se `w` ainda no foi visto entra na fila de prioridade; se j est na fila com um custo
+ * maior, o custo, o antecessor e a chave descem. Como a estimativa de `w` no muda, a
+ * chave desce tanto como o custo e a heurstica s  chamada na primeira vez.
+ *
+ * @param ctx Apontador para o contexto da procura.
+ * @param v Vrtice a ser expandido.
+ * @param w Vrtice a relaxar.
+ * @param custo Custo de `w` passando por `v`.
+ * @param heuristica Estimativa somada ao custo (A*), ou NULL para Dijkstra.
+ * @param dados Apontador passado  heurstica.
+ */
+void relaxarVertice(ContextoProcura* ctx, const Vertice* v, const Vertice* w, double custo,
+    Heuristica heuristica, const void* dados) {
+    HeapIndexado* heap = &ctx->heap;
+    int i = w->indice;
+
+    if (!foiVisitado(ctx, w)) {
+        marcarVisitado(ctx, w);
+        ctx->custos[i] = custo;
+        ctx->pais[i] = v->indice;
+        inserirHeap(heap, i, heuristica ? custo + heuristica(w, dados) : custo, -custo);
+    }
+    else if (heap->posicao[i] >= 0 && custo < ctx->custos[i]) {
+        double chave = heap->entradas[heap->posicao[i]].chave - (ctx->custos[i] - custo);
+        ctx->custos[i] = custo;
+        ctx->pais[i] = v->indice;
+        diminuirChaveHeap(heap, i, chave, -custo);
+    }
+}
+
+/**
+ * @brief Ciclo comum de Dijkstra e A*.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param grafo Apontador para o grafo.
+ * @param origem Vrtice de partida.
+ * @param destino Vrtice de chegada, ou NULL para alcanar todos os vrtices.
+ * @param heuristica Estimativa somada ao custo (A*), ou NULL para Dijkstra.
+ * @param dados Apontador passado  heurstica.
+ * @return Nmero de vrtices fechados, ou -1 se parmetros invlidos ou faltar memria.
+ */
+static int procurarCaminho(ContextoProcura* ctx, const GR* grafo, Vertice* origem, Vertice* destino,
+    Heuristica heuristica, const void* dados) {
+    if (origem == NULL || origem->indice < 0 || iniciarProcura(ctx, grafo) != 0) return -1;
+    if (destino != NULL && destino->indice < 0) return -1;
+
+    HeapIndexado* heap = &ctx->heap;
+    double* custos = ctx->custos;
+    int* pais = ctx->pais;
+    int fechados = 0;
+
+    esvaziarHeap(heap);
+    ctx->epocaCaminho = ctx->epoca;
+    marcarVisitado(ctx, origem);
+    custos[origem->indice] = 0.0;
+    pais[origem->indice] = -1;
+    inserirHeap(heap, origem->indice, heuristica ? heuristica(origem, dados) : 0.0, 0.0);
+
+    while (heap->tamanho > 0) {
+        Vertice* v = grafo->porIndice[extrairMinimoHeap(heap)];
+        fechados++;
+        if (v == destino) break;
+
+        double custoV = custos[v->indice];
+        for (Aresta* a = v->adj; a != NULL; a = a->next) {
+            relaxarVertice(ctx, v, a->destino, custoV + a->peso, heuristica, dados);
+        }
+    }
+    ctx->expandidos = fechados;
+    return fechados;
+}
+
+/**
+ * @brief Caminho mais curto entre dois vrtices, com uma heurstica dada pelo chamador.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param grafo Apontador para o grafo.
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @param heuristica Estimativa do custo at ao destino, ou NULL (Dijkstra).
+ * @param dados Apontador passado  heurstica.
+ * @param custo Recebe o custo do caminho (-1 se no existir), se no for NULL.
+ * @return Nmero de vrtices do caminho, 0 se no existir, -1 em caso de erro.
+ */
+int caminhoHeuristica(ContextoProcura* ctx, const GR* grafo, Vertice* origem, Vertice* destino,
+    Heuristica heuristica, const void* dados, double* custo) {
+    if (destino == NULL) return -1;
+    if (procurarCaminho(ctx, grafo, origem, destino, heuristica, dados) < 0) return -1;
+
+    int n = reconstruirCaminho(ctx, grafo, destino);
+    if (custo) *custo = n > 0 ? ctx->custos[destino->indice] : -1.0;
+    return n;
+}
+
+/**
+ * @brief Caminhos mais curtos de uma origem para todos os vrtices (Dijkstra).
+ *
+ * @param ctx Apontador para o contexto.
+ * @param grafo Apontador para o grafo.
+ * @param origem Apontador para o vrtice de partida.
+ * @return Nmero de vrtices alcanados, ou -1 em caso de erro.
+ */
+int dijkstra(ContextoProcura* ctx, const GR* grafo, Vertice* origem) {
+    return procurarCaminho(ctx, grafo, origem, NULL, NULL, NULL);
+}
+
+/**
+ * @brief Caminho mais curto entre dois vrtices (Dijkstra com paragem no destino).
+ *
+ * @param ctx Apontador para o contexto.
+ * @param grafo Apontador para o grafo.
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @param custo Recebe o custo do caminho (-1 se no existir), se no for NULL.
+ * @return Nmero de vrtices do caminho, 0 se no existir, -1 em caso de erro.
+ */
+int caminhoDijkstra(ContextoProcura* ctx, const GR* grafo, Vertice* origem, Vertice* destino, double* custo) {
+    return caminhoHeuristica(ctx, grafo, origem, destino, NULL, NULL, custo);
+}
+
+/**
+ * @brief Caminho mais curto entre dois vrtices (A* com a distncia octil).
+ *
+ * @param ctx Apontador para o contexto.
+ * @param grafo Apontador para o grafo.
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @param custo Recebe o custo do caminho (-1 se no existir), se no for NULL.
+ * @return Nmero de vrtices do caminho, 0 se no existir, -1 em caso de erro.
+ */
+int caminhoAEstrela(ContextoProcura* ctx, const GR* grafo, Vertice* origem, Vertice* destino, double* custo) {
+    return caminhoHeuristica(ctx, grafo, origem, destino, heuristicaOctil, destino, custo);
+}
+
+/**
+ * @brief Devolve o custo de um vrtice na ltima procura de caminho.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param v Apontador para o vrtice.
+ * @return Custo desde a origem, ou -1 se no foi alcanado ou se a ltima procura do
+ *         contexto no foi de caminho mais curto.
+ */
+double custoProcura(const ContextoProcura* ctx, const Vertice* v) {
+    if (!ctx || !v || !indiceNoContexto(ctx, v) || ctx->epocaCaminho != ctx->epoca || !foiVisitado(ctx, v)) return -1.0;
+    return ctx->custos[v->indice];
+}
+
+/**
+ * @brief Reconstri o caminho at `destino`, seguindo os antecessores.
+ *
+ * O caminho  escrito do fim para o incio e depois invertido.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param grafo Apontador para o grafo.
+ * @param destino Apontador para o vrtice de chegada.
+ * @return Nmero de vrtices do caminho, ou 0 se `destino` no foi alcanado ou se a
+ *         ltima procura do contexto no calculou antecessores.
+ */
+int reconstruirCaminho(ContextoProcura* ctx, const GR* grafo, Vertice* destino) {
+    if (!ctx || !grafo || !destino || !indiceNoContexto(ctx, destino) || !foiVisitado(ctx, destino)) return 0;
+    if (ctx->epocaLargura != ctx->epoca && ctx->epocaCaminho != ctx->epoca) return 0;
+
+    int n = 0;
+    for (int i = destino->indice; i >= 0; i = ctx->pais[i]) {
+        ctx->caminho[n++] = grafo->porIndice[i];
+    }
+    for (int a = 0, b = n - 1; a < b; a++, b--) {
+        Vertice* t = ctx->caminho[a];
+        ctx->caminho[a] = ctx->caminho[b];
+        ctx->caminho[b] = t;
+    }
+    return n;
+}
@@ -0,0 +1,157 @@
+#ifndef FUNCOESCAMINHOMINIMO_H
+#define FUNCOESCAMINHOMINIMO_H
+
+/**
+ * @file FuncoesCaminhoMinimo.h
+ * @brief Declarao das funes de caminho mais curto (Dijkstra e A*).
+ *
+ * As procuras usam os pesos das arestas e guardam os resultados num `ContextoProcura`:
+ * o custo de cada vrtice (`custoProcura`), o antecessor (`paiProcura`) e o caminho
+ * reconstrudo em `ctx->caminho`.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "Structs.h"
+
+ /**
+  * @brief Estimativa do custo de um vrtice at ao destino de uma procura A*.
+  *
+  * Para o caminho devolvido ser o mais curto, a estimativa no pode exceder o custo real
+  * e no pode descer mais do que o peso de uma aresta entre vrtices vizinhos.
+  *
+  * @param v Vrtice a estimar.
+  * @param dados Apontador dado pelo chamador da procura.
+  * @return Estimativa do custo de `v` at ao destino.
+  */
+typedef double (*Heuristica)(const Vertice* v, const void* dados);
+
+/**
+ * @brief Distncia octil entre duas posies do mapa.
+ *
+ *  o custo mnimo de um caminho com movimentos ortogonais (peso 1.0) e diagonais
+ * (peso 1.414): as diagonais cobrem a menor das diferenas e o resto  em linha reta.
+ *
+ * @param dx Diferena entre as coordenadas x.
+ * @param dy Diferena entre as coordenadas y.
+ * @return Distncia octil.
+ */
+double distanciaOctil(int dx, int dy);
+
+/**
+ * @brief Heurstica de A* com a distncia octil at ao destino.
+ *
+ * @param v Vrtice a estimar.
+ * @param dados Apontador para o vrtice de destino.
+ * @return Distncia octil de `v` ao destino.
+ */
+double heuristicaOctil(const Vertice* v, const void* dados);
+
+/**
+ * @brief Relaxa um vrtice durante uma procura de caminho mais curto.
+ *
+ * Passo comum a Dijkstra, A* e Jump Point Search: se `w` ainda no foi visto entra na
+ * fila de prioridade do contexto; se j l est com um custo maior, o custo e o
+ * antecessor so atualizados.
+ *
+ * @param ctx Apontador para o contexto da procura.
+ * @param v Vrtice a ser expandido.
+ * @param w Vrtice a relaxar.
+ * @param custo Custo de `w` passando por `v`.
+ * @param heuristica Estimativa somada ao custo (A*), ou NULL para Dijkstra.
+ * @param dados Apontador passado  heurstica.
+ */
+void relaxarVertice(ContextoProcura* ctx, const Vertice* v, const Vertice* w, double custo,
+    Heuristica heuristica, const void* dados);
+
+/**
+ * @brief Calcula o caminho mais curto de uma origem para todos os vrtices alcanveis.
+ *
+ * Depois da chamada, `custoProcura` e `paiProcura` do o custo e o antecessor de cada
+ * vrtice alcanado.
+ *
+ * @param ctx Apontador para o contexto (uma thread de cada vez).
+ * @param grafo Apontador para o grafo que contm `origem`.
+ * @param origem Apontador para o vrtice de partida.
+ * @return Nmero de vrtices alcanados (incluindo a origem), ou -1 se parmetros
+ *         invlidos ou faltar memria.
+ */
+int dijkstra(ContextoProcura* ctx, const GR* grafo, Vertice* origem);
+
+/**
+ * @brief Calcula o caminho mais curto entre dois vrtices com o algoritmo de Dijkstra.
+ *
+ * A procura pra quando o destino sai da fila de prioridade. O caminho fica em
+ * `ctx->caminho[0 .. n-1]`, da origem ao destino.
+ *
+ * @param ctx Apontador para o contexto (uma thread de cada vez).
+ * @param grafo Apontador para o grafo.
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @param custo Se no for NULL, recebe o custo do caminho.
+ * @return Nmero de vrtices do caminho, 0 se o destino no for alcanvel, ou -1 se
+ *         parmetros invlidos ou faltar memria.
+ */
+int caminhoDijkstra(ContextoProcura* ctx, const GR* grafo, Vertice* origem, Vertice* destino, double* custo);
+
+/**
+ * @brief Calcula o caminho mais curto entre dois vrtices com o algoritmo A*.
+ *
+ * A heurstica  a distncia octil entre as coordenadas dos vrtices, que  a distncia
+ * mnima num mapa com movimentos ortogonais (peso 1.0) e diagonais (peso 1.414), como as
+ * arestas criadas por `criarArestasAdjacentes`. Com arestas de peso inferior  distncia
+ * octil entre os seus vrtices o caminho devolvido pode no ser o mais curto.
+ *
+ * @param ctx Apontador para o contexto (uma thread de cada vez).
+ * @param grafo Apontador para o grafo.
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @param custo Se no for NULL, recebe o custo do caminho.
+ * @return Nmero de vrtices do caminho, 0 se o destino no for alcanvel, ou -1 se
+ *         parmetros invlidos ou faltar memria.
+ */
+int caminhoAEstrela(ContextoProcura* ctx, const GR* grafo, Vertice* origem, Vertice* destino, double* custo);
+
+/**
+ * @brief Calcula o caminho mais curto entre dois vrtices com A* e uma heurstica dada.
+ *
+ * @param ctx Apontador para o contexto (uma thread de cada vez).
+ * @param grafo Apontador para o grafo.
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @param heuristica Estimativa do custo at ao destino (NULL equivale a `caminhoDijkstra`).
+ * @param dados Apontador passado  heurstica.
+ * @param custo Se no for NULL, recebe o custo do caminho.
+ * @return Nmero de vrtices do caminho, 0 se o destino no for alcanvel, ou -1 se
+ *         parmetros invlidos ou faltar memria.
+ */
+int caminhoHeuristica(ContextoProcura* ctx, const GR* grafo, Vertice* origem, Vertice* destino,
+    Heuristica heuristica, const void* dados, double* custo);
+
+/**
+ * @brief Devolve o custo desde a origem calculado pela ltima procura de caminho.
+ *
+ * Depois de `dijkstra` o custo  o mnimo; depois de uma procura entre dois vrtices s
+ *  garantidamente mnimo para os vrtices do caminho devolvido.
+ *
+ * @param ctx Apontador para o contexto usado na procura.
+ * @param v Apontador para o vrtice.
+ * @return Custo, ou -1 se `v` no foi alcanado ou a ltima procura do contexto no foi
+ *         de caminho mais curto.
+ */
+double custoProcura(const ContextoProcura* ctx, const Vertice* v);
+
+/**
+ * @brief Reconstri em `ctx->caminho` o caminho da origem da ltima procura at `destino`.
+ *
+ * @param ctx Apontador para o contexto usado na procura.
+ * @param grafo Apontador para o grafo da procura.
+ * @param destino Apontador para o vrtice de chegada.
+ * @return Nmero de vrtices do caminho, ou 0 se `destino` no foi alcanado ou a ltima
+ *         procura do contexto no calculou antecessores.
+ */
+int reconstruirCaminho(ContextoProcura* ctx, const GR* grafo, Vertice* destino);
+
+#endif // FUNCOESCAMINHOMINIMO_H
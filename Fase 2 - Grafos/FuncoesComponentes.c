@@ -0,0 +1,238 @@
+/**
+ * @file FuncoesComponentes.c
+ * @brief Implementao das componentes ligadas do grafo (union-find).
+ *
+ * @details
+ * A estrutura usa unio por tamanho (a componente menor fica debaixo da maior) e
+ * compresso de caminhos por diviso ao meio (cada vrtice visitado na procura da raiz
+ * passa a apontar para o av), o que d um custo amortizado quase constante por operao.
+ *
+ * `adicionarVertice` e `adicionarAresta` mantm a estrutura atualizada. Uma remoo no
+ * pode ser desfeita numa union-find (e troca os ndices densos), pelo que s a marca
+ * como invlida; a consulta seguinte reconstri-a em O(V + E).
+ *
+ * As consultas comprimem caminhos, pelo que alteram a estrutura: no devem ser feitas
+ * por vrias threads ao mesmo tempo sobre o mesmo grafo.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <stdlib.h>
+#include "Structs.h"
+#include "FuncoesComponentes.h"
+
+#define CAPACIDADE_MINIMA_COMPONENTES 16
+
+/**
+ * @brief Garante que os vetores das componentes tm pelo menos `n` posies.
+ *
+ * @return 0 se sucesso, -2 se faltar memria.
+ */
+static int reservarComponentes(Componentes* c, int n) {
+    if (n <= c->capacidade) return 0;
+
+    int capacidade = c->capacidade > 0 ? c->capacidade : CAPACIDADE_MINIMA_COMPONENTES;
+    while (capacidade < n) {
+        capacidade *= 2;
+    }
+
+    int* pai = realloc(c->pai, (size_t)capacidade * sizeof(int));
+    if (!pai) return -2;
+    c->pai = pai;
+    int* tamanho = realloc(c->tamanho, (size_t)capacidade * sizeof(int));
+    if (!tamanho) return -2;
+    c->tamanho = tamanho;
+    c->capacidade = capacidade;
+    return 0;
+}
+
+/**
+ * @brief Encontra a raiz da componente de `i`, comprimindo o caminho a meio.
+ */
+static int raiz(Componentes* c, int i) {
+    while (c->pai[i] != i) {
+        c->pai[i] = c->pai[c->pai[i]];
+        i = c->pai[i];
+    }
+    return i;
+}
+
+/**
+ * @brief Junta as componentes de `i` e `j` (ndices densos).
+ */
+static void unir(Componentes* c, int i, int j) {
+    i = raiz(c, i);
+    j = raiz(c, j);
+    if (i == j) return;
+    if (c->tamanho[i] < c->tamanho[j]) {
+        int t = i;
+        i = j;
+        j = t;
+    }
+    c->pai[j] = i;
+    c->tamanho[i] += c->tamanho[j];
+    c->numComponentes--;
+}
+
+/**
+ * @brief Reconstri as componentes: cada vrtice comea isolado e cada aresta junta duas componentes.
+ *
+ * @param grafo Apontador para o grafo.
+ * @return 0 se sucesso, -1 se o grafo for invlido, -2 se faltar memria.
+ */
+int construirComponentes(GR* grafo) {
+    if (!grafo) return -1;
+    Componentes* c = &grafo->componentes;
+    c->valida = 0;
+    if (reservarComponentes(c, grafo->numVertices) != 0) return -2;
+
+    for (int i = 0; i < grafo->numVertices; i++) {
+        c->pai[i] = i;
+        c->tamanho[i] = 1;
+    }
+    c->numComponentes = grafo->numVertices;
+
+    for (int i = 0; i < grafo->numVertices; i++) {
+        for (Aresta* a = grafo->porIndice[i]->adj; a != NULL; a = a->next) {
+            unir(c, i, a->destino->indice);
+        }
+    }
+    c->valida = 1;
+    return 0;
+}
+
+/**
+ * @brief Regista um novo vrtice como componente isolada.
+ *
+ * Se faltar memria, as componentes ficam por reconstruir.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ */
+void acrescentarComponente(GR* grafo, const Vertice* v) {
+    if (!grafo || !v || !grafo->componentes.valida) return;
+    Componentes* c = &grafo->componentes;
+    if (reservarComponentes(c, v->indice + 1) != 0) {
+        c->valida = 0;
+        return;
+    }
+    c->pai[v->indice] = v->indice;
+    c->tamanho[v->indice] = 1;
+    c->numComponentes++;
+}
+
+/**
+ * @brief Junta as componentes dos extremos de uma nova aresta.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param a Apontador para um vrtice.
+ * @param b Apontador para o outro vrtice.
+ */
+void unirComponentes(GR* grafo, const Vertice* a, const Vertice* b) {
+    if (!grafo || !a || !b || !grafo->componentes.valida) return;
+    unir(&grafo->componentes, a->indice, b->indice);
+}
+
+/**
+ * @brief Marca as componentes como desatualizadas.
+ *
+ * @param grafo Apontador para o grafo.
+ */
+void invalidarComponentes(GR* grafo) {
+    if (grafo) grafo->componentes.valida = 0;
+}
+
+/**
+ * @brief Reconstri as componentes se estiverem desatualizadas.
+ *
+ * @return 0 se sucesso, -2 se faltar memria.
+ */
+static int garantirComponentes(GR* grafo) {
+    if (grafo->componentes.valida) return 0;
+    return construirComponentes(grafo);
+}
+
+/**
+ * @brief Devolve o representante (ndice denso da raiz) da componente de um vrtice.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return ndice denso do representante, -1 se parmetros invlidos, -2 se faltar memria.
+ */
+int componenteDoVertice(GR* grafo, const Vertice* v) {
+    if (!grafo || !v || v->indice < 0 || v->indice >= grafo->numVertices) return -1;
+    if (garantirComponentes(grafo) != 0) return -2;
+    return raiz(&grafo->componentes, v->indice);
+}
+
+/**
+ * @brief Indica se dois vrtices esto na mesma componente.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param a Apontador para um vrtice.
+ * @param b Apontador para o outro vrtice.
+ * @return 1 se esto, 0 se no esto, -1 se parmetros invlidos, -2 se faltar memria.
+ */
+int mesmoComponente(GR* grafo, const Vertice* a, const Vertice* b) {
+    int ra = componenteDoVertice(grafo, a);
+    if (ra < 0) return ra;
+    int rb = componenteDoVertice(grafo, b);
+    if (rb < 0) return rb;
+    return ra == rb;
+}
+
+/**
+ * @brief Devolve o nmero de vrtices da componente de um vrtice.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return Tamanho da componente, -1 se parmetros invlidos, -2 se faltar memria.
+ */
+int tamanhoComponente(GR* grafo, const Vertice* v) {
+    int r = componenteDoVertice(grafo, v);
+    if (r < 0) return r;
+    return grafo->componentes.tamanho[r];
+}
+
+/**
+ * @brief Devolve o tamanho de cada componente, pela ordem do ndice denso do representante.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param numComponentes Recebe o nmero de componentes.
+ * @return Vetor alocado com os tamanhos, ou NULL em caso de erro ou grafo vazio.
+ */
+int* tamanhosComponentes(GR* grafo, int* numComponentes) {
+    if (numComponentes) *numComponentes = 0;
+    if (!grafo || !numComponentes || grafo->numVertices == 0) return NULL;
+    if (garantirComponentes(grafo) != 0) return NULL;
+
+    Componentes* c = &grafo->componentes;
+    int* tamanhos = malloc((size_t)c->numComponentes * sizeof(int));
+    if (!tamanhos) return NULL;
+
+    int n = 0;
+    for (int i = 0; i < grafo->numVertices; i++) {
+        if (c->pai[i] == i) tamanhos[n++] = c->tamanho[i];
+    }
+    *numComponentes = n;
+    return tamanhos;
+}
+
+/**
+ * @brief Liberta a memria das componentes.
+ *
+ * @param grafo Apontador para o grafo.
+ */
+void libertarComponentes(GR* grafo) {
+    if (!grafo) return;
+    Componentes* c = &grafo->componentes;
+    free(c->pai);
+    free(c->tamanho);
+    c->pai = NULL;
+    c->tamanho = NULL;
+    c->capacidade = 0;
+    c->numComponentes = 0;
+    c->valida = 0;
+}
@@ -0,0 +1,100 @@
+#ifndef FUNCOESCOMPONENTES_H
+#define FUNCOESCOMPONENTES_H
+
+/**
+ * @file FuncoesComponentes.h
+ * @brief Declarao das funes de componentes ligadas (union-find).
+ *
+ * Permite saber em tempo quase constante se duas antenas esto na mesma componente
+ * (grupo de antenas da mesma frequncia ligadas por arestas), sem fazer uma procura.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "Structs.h"
+
+ /**
+  * @brief Reconstri as componentes a partir dos vrtices e arestas do grafo.
+  *
+  * @param grafo Apontador para o grafo.
+  * @return 0 se sucesso, -1 se o grafo for invlido, -2 se faltar memria.
+  */
+int construirComponentes(GR* grafo);
+
+/**
+ * @brief Regista um vrtice acabado de adicionar ao grafo como uma componente isolada.
+ * No faz nada se as componentes estiverem por construir.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice (j com ndice denso).
+ */
+void acrescentarComponente(GR* grafo, const Vertice* v);
+
+/**
+ * @brief Junta as componentes de dois vrtices ligados por uma nova aresta.
+ * No faz nada se as componentes estiverem por construir.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param a Apontador para um vrtice.
+ * @param b Apontador para o outro vrtice.
+ */
+void unirComponentes(GR* grafo, const Vertice* a, const Vertice* b);
+
+/**
+ * @brief Marca as componentes como desatualizadas (depois de remover vrtices ou arestas).
+ *
+ * @param grafo Apontador para o grafo.
+ */
+void invalidarComponentes(GR* grafo);
+
+/**
+ * @brief Devolve o representante da componente de um vrtice.
+ *
+ * Dois vrtices esto na mesma componente se e s se tm o mesmo representante; o valor
+ * pode mudar quando o grafo  alterado.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return ndice denso do representante, -1 se parmetros invlidos, -2 se faltar memria.
+ */
+int componenteDoVertice(GR* grafo, const Vertice* v);
+
+/**
+ * @brief Indica se dois vrtices esto na mesma componente.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param a Apontador para um vrtice.
+ * @param b Apontador para o outro vrtice.
+ * @return 1 se esto, 0 se no esto, -1 se parmetros invlidos, -2 se faltar memria.
+ */
+int mesmoComponente(GR* grafo, const Vertice* a, const Vertice* b);
+
+/**
+ * @brief Devolve o nmero de vrtices da componente de um vrtice.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return Tamanho da componente, -1 se parmetros invlidos, -2 se faltar memria.
+ */
+int tamanhoComponente(GR* grafo, const Vertice* v);
+
+/**
+ * @brief Devolve o tamanho de cada componente do grafo.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param numComponentes Recebe o nmero de componentes (tamanho do vetor devolvido).
+ * @return Vetor com o tamanho de cada componente, a libertar com `free`, ou NULL se o
+ *         grafo for invlido, no tiver vrtices ou faltar memria.
+ */
+int* tamanhosComponentes(GR* grafo, int* numComponentes);
+
+/**
+ * @brief Liberta a memria das componentes, deixando-as por construir.
+ *
+ * @param grafo Apontador para o grafo.
+ */
+void libertarComponentes(GR* grafo);
+
+#endif // FUNCOESCOMPONENTES_H
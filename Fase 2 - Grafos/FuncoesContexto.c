@@ -0,0 +1,176 @@
+/**
+ * @file FuncoesContexto.c
+ * @brief Implementao dos contextos de procura.
+ *
+ * @details
+ * Cada vrtice tem no contexto uma marca com a poca em que foi visitado. Um vrtice
+ * est visitado se a sua marca for igual  poca atual, pelo que `iniciarProcura` s
+ * incrementa a poca. Quando a poca d a volta (ao fim de 2^32 - 1 procuras), as
+ * marcas so limpas uma vez e a contagem recomea em 1; a marca 0 nunca  uma poca
+ * vlida e serve para desmarcar um vrtice.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "Structs.h"
+#include "FuncoesContexto.h"
+#include "FuncoesHeap.h"
+
+#define CAPACIDADE_MINIMA_CONTEXTO 16
+
+/**
+ * @brief Aumenta os vetores do contexto para pelo menos `numVertices` posies.
+ *
+ * As marcas novas ficam a 0 (no visitadas).
+ *
+ * @param ctx Apontador para o contexto.
+ * @param numVertices Nmero de posies pretendido.
+ * @return 0 se sucesso, -2 se faltar memria (o contexto fica como estava).
+ */
+static int crescerContexto(ContextoProcura* ctx, int numVertices) {
+    if (numVertices <= ctx->capacidade) return 0;
+
+    int capacidade = ctx->capacidade > 0 ? ctx->capacidade : CAPACIDADE_MINIMA_CONTEXTO;
+    while (capacidade < numVertices) {
+        capacidade *= 2;
+    }
+
+    unsigned int* marcas = realloc(ctx->marcas, (size_t)capacidade * sizeof(unsigned int));
+    if (!marcas) return -2;
+    ctx->marcas = marcas;
+    memset(marcas + ctx->capacidade, 0, (size_t)(capacidade - ctx->capacidade) * sizeof(unsigned int));
+
+    Vertice** fila = realloc(ctx->fila, (size_t)capacidade * sizeof(Vertice*));
+    if (!fila) return -2;
+    ctx->fila = fila;
+
+    Aresta** cursores = realloc(ctx->cursores, (size_t)capacidade * sizeof(Aresta*));
+    if (!cursores) return -2;
+    ctx->cursores = cursores;
+
+    Vertice** caminho = realloc(ctx->caminho, (size_t)capacidade * sizeof(Vertice*));
+    if (!caminho) return -2;
+    ctx->caminho = caminho;
+
+    int* distancias = realloc(ctx->distancias, (size_t)capacidade * sizeof(int));
+    if (!distancias) return -2;
+    ctx->distancias = distancias;
+
+    int* pais = realloc(ctx->pais, (size_t)capacidade * sizeof(int));
+    if (!pais) return -2;
+    ctx->pais = pais;
+
+    double* custos = realloc(ctx->custos, (size_t)capacidade * sizeof(double));
+    if (!custos) return -2;
+    ctx->custos = custos;
+
+    if (reservarHeap(&ctx->heap, capacidade) != 0) return -2;
+
+    ctx->capacidade = capacidade;  // s depois de todos os vetores terem crescido
+    return 0;
+}
+
+/**
+ * @brief Cria um contexto de procura vazio, j dimensionado para o grafo.
+ *
+ * @param grafo Apontador para o grafo, ou NULL.
+ * @return Apontador para o contexto ou NULL se faltar memria.
+ */
+ContextoProcura* criarContextoProcura(const GR* grafo) {
+    ContextoProcura* ctx = calloc(1, sizeof(ContextoProcura));
+    if (!ctx) return NULL;
+
+    if (grafo && crescerContexto(ctx, grafo->numVertices) != 0) {
+        libertarContextoProcura(ctx);
+        return NULL;
+    }
+    return ctx;
+}
+
+/**
+ * @brief Liberta a memria de um contexto de procura.
+ *
+ * @param ctx Apontador para o contexto.
+ */
+void libertarContextoProcura(ContextoProcura* ctx) {
+    if (!ctx) return;
+    free(ctx->marcas);
+    free(ctx->fila);
+    free(ctx->cursores);
+    free(ctx->caminho);
+    free(ctx->distancias);
+    free(ctx->pais);
+    free(ctx->custos);
+    libertarHeap(&ctx->heap);
+    free(ctx);
+}
+
+/**
+ * @brief Comea uma nova procura: todos os vrtices deixam de estar visitados.
+ *
+ * Os resultados da procura anterior (distncias, antecessores e custos) deixam tambm
+ * de ser vlidos, porque as pocas em `epocaLargura` e `epocaCaminho` ficam para trs.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param grafo Apontador para o grafo.
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se faltar memria.
+ */
+int iniciarProcura(ContextoProcura* ctx, const GR* grafo) {
+    if (!ctx || !grafo) return -1;
+    if (crescerContexto(ctx, grafo->numVertices) != 0) return -2;
+
+    ctx->epoca++;
+    if (ctx->epoca == 0) {  // deu a volta: limpar as marcas antigas
+        memset(ctx->marcas, 0, (size_t)ctx->capacidade * sizeof(unsigned int));
+        ctx->epoca = 1;
+        ctx->epocaLargura = 0;
+        ctx->epocaCaminho = 0;
+    }
+    return 0;
+}
+
+/**
+ * @brief Marca um vrtice como visitado na procura atual.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param v Apontador para o vrtice.
+ */
+void marcarVisitado(ContextoProcura* ctx, const Vertice* v) {
+    ctx->marcas[v->indice] = ctx->epoca;
+}
+
+/**
+ * @brief Desmarca um vrtice na procura atual.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param v Apontador para o vrtice.
+ */
+void desmarcarVisitado(ContextoProcura* ctx, const Vertice* v) {
+    ctx->marcas[v->indice] = 0;
+}
+
+/**
+ * @brief Indica se o ndice denso de um vrtice cabe nos vetores do contexto.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param v Apontador para o vrtice.
+ * @return 1 se 0 <= v->indice < ctx->capacidade, 0 caso contrrio.
+ */
+int indiceNoContexto(const ContextoProcura* ctx, const Vertice* v) {
+    return v->indice >= 0 && v->indice < ctx->capacidade;
+}
+
+/**
+ * @brief Indica se um vrtice j foi visitado na procura atual.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param v Apontador para o vrtice.
+ * @return 1 se visitado, 0 caso contrrio (tambm se o ndice no couber no contexto).
+ */
+int foiVisitado(const ContextoProcura* ctx, const Vertice* v) {
+    return indiceNoContexto(ctx, v) && ctx->marcas[v->indice] == ctx->epoca;
+}
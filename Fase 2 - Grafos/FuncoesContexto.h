@@ -0,0 +1,82 @@
+#ifndef FUNCOESCONTEXTO_H
+#define FUNCOESCONTEXTO_H
+
+/**
+ * @file FuncoesContexto.h
+ * @brief Declarao das funes de gesto dos contextos de procura.
+ *
+ * Um contexto guarda as marcas de visita de uma procura fora dos vrtices, indexadas
+ * pelo ndice denso. Reiniciar as marcas  O(1) e cada thread pode ter o seu contexto.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "Structs.h"
+
+ /**
+  * @brief Cria um contexto de procura com capacidade para os vrtices de um grafo.
+  *
+  * @param grafo Apontador para o grafo (pode ser NULL: o contexto cresce depois).
+  * @return Apontador para o contexto ou NULL se faltar memria.
+  */
+ContextoProcura* criarContextoProcura(const GR* grafo);
+
+/**
+ * @brief Liberta a memria de um contexto de procura.
+ *
+ * @param ctx Apontador para o contexto.
+ */
+void libertarContextoProcura(ContextoProcura* ctx);
+
+/**
+ * @brief Prepara o contexto para uma nova procura sobre o grafo.
+ *
+ * Todos os vrtices passam a no visitados, sem percorrer o grafo. Se o grafo tiver
+ * crescido desde a ltima procura, os vetores do contexto so aumentados.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param grafo Apontador para o grafo.
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se faltar memria.
+ */
+int iniciarProcura(ContextoProcura* ctx, const GR* grafo);
+
+/**
+ * @brief Marca um vrtice como visitado na procura atual.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param v Apontador para o vrtice.
+ */
+void marcarVisitado(ContextoProcura* ctx, const Vertice* v);
+
+/**
+ * @brief Desmarca um vrtice na procura atual (usado ao recuar nos caminhos).
+ *
+ * @param ctx Apontador para o contexto.
+ * @param v Apontador para o vrtice.
+ */
+void desmarcarVisitado(ContextoProcura* ctx, const Vertice* v);
+
+/**
+ * @brief Indica se o ndice denso de um vrtice cabe nos vetores do contexto.
+ *
+ * Um vrtice removido tem ndice -1, e um acrescentado depois de o contexto ser
+ * dimensionado pode ter um ndice para l de `ctx->capacidade`.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param v Apontador para o vrtice.
+ * @return 1 se 0 <= v->indice < ctx->capacidade, 0 caso contrrio.
+ */
+int indiceNoContexto(const ContextoProcura* ctx, const Vertice* v);
+
+/**
+ * @brief Indica se um vrtice j foi visitado na procura atual.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param v Apontador para o vrtice.
+ * @return 1 se visitado, 0 caso contrrio (tambm se o ndice no couber no contexto).
+ */
+int foiVisitado(const ContextoProcura* ctx, const Vertice* v);
+
+#endif // FUNCOESCONTEXTO_H
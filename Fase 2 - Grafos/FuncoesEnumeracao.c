@@ -0,0 +1,424 @@
+/**
+ * @file FuncoesEnumeracao.c
+ * @brief Implementao do motor de enumerao de caminhos simples.
+ *
+ * @details
+ * Cada thread tem um `Explorador`: um contexto cujas marcas so os vrtices do caminho
+ * corrente, outro para a procura em largura de corte, e uma pilha de candidatos. Ao
+ * expandir o vrtice na posio d do caminho, os vizinhos que ainda chegam ao destino
+ * so empilhados com a profundidade d + 1; ao desempilhar um candidato, o caminho 
+ * cortado nessa profundidade e o candidato acrescentado. Os candidatos de um vrtice
+ * so calculados uma vez, com o caminho at ele, e continuam vlidos enquanto os seus
+ * irmos so explorados.
+ *
+ * A procura de corte  refeita em cada vrtice expandido e pra  distncia que o limite
+ * de comprimento ainda permite. Assim, todo o vrtice explorado est num caminho
+ * entregue, e o trabalho  proporcional ao nmero de caminhos.
+ *
+ * Em paralelo, o trabalho  distribudo por roubo: h uma lista partilhada de prefixos
+ * (caminhos j comeados), que no incio s contm a origem. Uma thread sem trabalho
+ * regista-se como ociosa e espera por um prefixo. Uma thread ocupada, ao ver threads
+ * ociosas, cede-lhes os candidatos do fundo da sua pilha: so os menos profundos, logo
+ * os que tm as maiores subrvores por explorar. Cada candidato cedido passa a ser um
+ * prefixo (o caminho at ao seu pai, mais ele). Assim, um ramo pesado  repartido
+ * enquanto houver threads paradas, e a enumerao termina quando todas as threads que
+ * comearam esto ociosas e a lista est vazia (uma thread que comece depois disso sai
+ * logo, o que tambm cobre as partes que `executarEmParalelo` corre sem thread prpria).
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "Structs.h"
+#include "FuncoesEnumeracao.h"
+#include "FuncoesContexto.h"
+#include "FuncoesThreads.h"
+
+#define CAPACIDADE_INICIAL_CANDIDATOS 64
+#define CAPACIDADE_INICIAL_TAREFAS 16
+
+/**
+ * @brief Estado partilhado por todas as threads de uma enumerao.
+ */
+typedef struct Enumeracao {
+    const GR* grafo;             /**< Grafo */
+    Vertice* destino;            /**< Vrtice de chegada */
+    int comprimentoMaximo;       /**< Vrtices por caminho (0 = sem limite) */
+    int maxCaminhos;             /**< Caminhos a entregar (0 = sem limite) */
+    VisitanteCaminho visitante;  /**< Recebe cada caminho */
+    void* dados;                 /**< Passado ao visitante */
+    volatile int entregues;      /**< Caminhos entregues */
+    volatile int parar;          /**< 1 para terminar todas as threads */
+    volatile int erro;           /**< 1 se faltou memria numa thread ou o visitante falhou */
+    volatile int trinco;         /**< Excluso mtua das chamadas ao visitante */
+    int paralelo;                /**< 1 se h mais de uma thread */
+    volatile int ativas;         /**< Threads que j comearam a tarefa */
+    int** tarefas;               /**< Prefixos por explorar: [0] = comprimento, seguido dos ndices densos */
+    int numTarefas;              /**< Prefixos na lista */
+    int capacidadeTarefas;       /**< Posies da lista */
+    volatile int trincoTarefas;  /**< Excluso mtua da lista de prefixos */
+    volatile int ociosas;        /**< Threads  espera de um prefixo */
+    volatile int pendentes;      /**< Cpia de `numTarefas`, para leitura sem o trinco */
+    volatile int terminada;      /**< 1 quando todas as threads esto ociosas e a lista vazia */
+} Enumeracao;
+
+/**
+ * @brief Estado de uma thread.
+ */
+typedef struct Explorador {
+    ContextoProcura* caminho;    /**< Marcas = vrtices do caminho; `caminho->caminho` = caminho */
+    ContextoProcura* alcance;    /**< Procura em largura a partir do destino */
+    Vertice** candidatos;        /**< Vizinhos por explorar */
+    int* profundidades;          /**< Posio de cada candidato no caminho */
+    int numCandidatos;           /**< Candidatos na pilha */
+    int capacidade;              /**< Posies da pilha */
+} Explorador;
+
+static int criarExplorador(Explorador* x, const GR* grafo) {
+    memset(x, 0, sizeof(Explorador));
+    x->caminho = criarContextoProcura(grafo);
+    x->alcance = criarContextoProcura(grafo);
+    x->candidatos = malloc(CAPACIDADE_INICIAL_CANDIDATOS * sizeof(Vertice*));
+    x->profundidades = malloc(CAPACIDADE_INICIAL_CANDIDATOS * sizeof(int));
+    x->capacidade = CAPACIDADE_INICIAL_CANDIDATOS;
+    return x->caminho && x->alcance && x->candidatos && x->profundidades ? 0 : -2;
+}
+
+static void libertarExplorador(Explorador* x) {
+    libertarContextoProcura(x->caminho);
+    libertarContextoProcura(x->alcance);
+    free(x->candidatos);
+    free(x->profundidades);
+}
+
+/**
+ * @brief Empilha um candidato, aumentando a pilha se necessrio.
+ *
+ * @return 0 se sucesso, -2 se faltar memria.
+ */
+static int empilharCandidato(Explorador* x, Vertice* v, int profundidade) {
+    if (x->numCandidatos == x->capacidade) {
+        int capacidade = x->capacidade * 2;
+        Vertice** candidatos = realloc(x->candidatos, (size_t)capacidade * sizeof(Vertice*));
+        if (!candidatos) return -2;
+        x->candidatos = candidatos;
+        int* profundidades = realloc(x->profundidades, (size_t)capacidade * sizeof(int));
+        if (!profundidades) return -2;
+        x->profundidades = profundidades;
+        x->capacidade = capacidade;
+    }
+    x->candidatos[x->numCandidatos] = v;
+    x->profundidades[x->numCandidatos] = profundidade;
+    x->numCandidatos++;
+    return 0;
+}
+
+/**
+ * @brief Marca, a partir do destino, os vrtices que lhe chegam sem passar pelo caminho
+ * corrente e com no mximo `limite` arestas (limite < 0: sem limite).
+ */
+static void marcarAlcance(Explorador* x, const Enumeracao* e, int limite) {
+    ContextoProcura* a = x->alcance;
+    iniciarProcura(a, e->grafo);  // o contexto j tem o tamanho do grafo
+
+    int inicio = 0, fim = 0;
+    marcarVisitado(a, e->destino);
+    a->distancias[e->destino->indice] = 0;
+    a->fila[fim++] = e->destino;
+
+    while (inicio < fim) {
+        Vertice* v = a->fila[inicio++];
+        int distancia = a->distancias[v->indice];
+        if (distancia == limite) continue;
+        for (Aresta* ar = v->adj; ar != NULL; ar = ar->next) {
+            Vertice* w = ar->destino;
+            if (foiVisitado(a, w) || foiVisitado(x->caminho, w)) continue;
+            marcarVisitado(a, w);
+            a->distancias[w->indice] = distancia + 1;
+            a->fila[fim++] = w;
+        }
+    }
+}
+
+/**
+ * @brief Empilha os vizinhos do ltimo vrtice do caminho (posio `pos`) que ainda
+ * chegam ao destino, pela ordem da lista de adjacncia.
+ *
+ * @return 0 se sucesso, -2 se faltar memria.
+ */
+static int expandir(Explorador* x, const Enumeracao* e, int pos) {
+    Vertice* v = x->caminho->caminho[pos];
+    // o vizinho fica na posio pos + 1; ao destino restam (mximo - 1) - (pos + 1) arestas
+    int limite = e->comprimentoMaximo > 0 ? e->comprimentoMaximo - pos - 2 : -1;
+    if (e->comprimentoMaximo > 0 && limite < 0) return 0;
+
+    marcarAlcance(x, e, limite);
+
+    int base = x->numCandidatos;
+    for (Aresta* a = v->adj; a != NULL; a = a->next) {
+        Vertice* w = a->destino;
+        if (!foiVisitado(x->caminho, w) && foiVisitado(x->alcance, w)) {
+            if (empilharCandidato(x, w, pos + 1) != 0) return -2;
+        }
+    }
+    // inverter para que o primeiro vizinho da lista seja o primeiro a sair
+    for (int i = base, j = x->numCandidatos - 1; i < j; i++, j--) {
+        Vertice* t = x->candidatos[i];
+        x->candidatos[i] = x->candidatos[j];
+        x->candidatos[j] = t;
+    }
+    return 0;
+}
+
+/**
+ * @brief Pede a todas as threads que terminem.
+ */
+static void pararEnumeracao(Enumeracao* e) {
+    compararETrocarInteiro(&e->parar, 0, 1);
+}
+
+/**
+ * @brief Entrega um caminho ao visitante, respeitando o nmero mximo de caminhos.
+ *
+ * @return 1 se a enumerao deve terminar, 0 caso contrrio.
+ */
+static int entregar(Enumeracao* e, Vertice** caminho, int tamanho) {
+    if (lerAtomicoInteiro(&e->parar)) return 1;
+    int ordem = somarAtomicoInteiro(&e->entregues, 1);
+    if (e->maxCaminhos > 0 && ordem >= e->maxCaminhos) {
+        somarAtomicoInteiro(&e->entregues, -1);  // no foi entregue
+        pararEnumeracao(e);
+        return 1;
+    }
+
+    if (e->paralelo) {
+        while (!compararETrocarInteiro(&e->trinco, 0, 1)) {
+            cederProcessador();
+        }
+    }
+    int resultado = e->visitante(caminho, tamanho, e->dados);
+    if (e->paralelo) compararETrocarInteiro(&e->trinco, 1, 0);
+
+    if (resultado < 0) compararETrocarInteiro(&e->erro, 0, 1);  // por exemplo, falha de escrita
+    if (resultado != 0 || (e->maxCaminhos > 0 && ordem + 1 >= e->maxCaminhos)) {
+        pararEnumeracao(e);
+        return 1;
+    }
+    return 0;
+}
+
+static void fecharTrinco(volatile int* trinco) {
+    while (!compararETrocarInteiro(trinco, 0, 1)) {
+        cederProcessador();
+    }
+}
+
+static void abrirTrinco(volatile int* trinco) {
+    compararETrocarInteiro(trinco, 1, 0);
+}
+
+/**
+ * @brief Acrescenta um prefixo  lista partilhada.
+ *
+ * @param prefixo Vrtices do prefixo, excepto o ltimo.
+ * @param comprimento Nmero de vrtices em `prefixo`.
+ * @param ultimo ltimo vrtice do prefixo.
+ * @return 0 se sucesso, -2 se faltar memria (a lista fica como estava).
+ */
+static int publicarPrefixo(Enumeracao* e, Vertice** prefixo, int comprimento, Vertice* ultimo) {
+    int* tarefa = malloc((size_t)(comprimento + 2) * sizeof(int));
+    if (!tarefa) return -2;
+    tarefa[0] = comprimento + 1;
+    for (int i = 0; i < comprimento; i++) {
+        tarefa[i + 1] = prefixo[i]->indice;
+    }
+    tarefa[comprimento + 1] = ultimo->indice;
+
+    fecharTrinco(&e->trincoTarefas);
+    if (e->numTarefas == e->capacidadeTarefas) {
+        int capacidade = e->capacidadeTarefas > 0 ? e->capacidadeTarefas * 2 : CAPACIDADE_INICIAL_TAREFAS;
+        int** maior = realloc(e->tarefas, (size_t)capacidade * sizeof(int*));
+        if (!maior) {
+            abrirTrinco(&e->trincoTarefas);
+            free(tarefa);
+            return -2;
+        }
+        e->tarefas = maior;
+        e->capacidadeTarefas = capacidade;
+    }
+    e->tarefas[e->numTarefas++] = tarefa;
+    somarAtomicoInteiro(&e->pendentes, 1);
+    abrirTrinco(&e->trincoTarefas);
+    return 0;
+}
+
+/**
+ * @brief Retira um prefixo da lista, esperando como ociosa enquanto outras threads trabalham.
+ *
+ * @return O prefixo (a libertar por quem o recebe), ou NULL se a enumerao terminou.
+ */
+static int* obterPrefixo(Enumeracao* e) {
+    int ociosa = 0;
+    for (;;) {
+        if (lerAtomicoInteiro(&e->parar) || lerAtomicoInteiro(&e->terminada)) break;
+        if (lerAtomicoInteiro(&e->pendentes) > 0 || !ociosa) {
+            fecharTrinco(&e->trincoTarefas);
+            if (e->numTarefas > 0) {
+                int* tarefa = e->tarefas[--e->numTarefas];
+                somarAtomicoInteiro(&e->pendentes, -1);
+                if (ociosa) somarAtomicoInteiro(&e->ociosas, -1);
+                abrirTrinco(&e->trincoTarefas);
+                return tarefa;
+            }
+            if (!ociosa) {
+                ociosa = 1;
+                // a ltima thread a ficar ociosa, com a lista vazia, termina a enumerao
+                if (somarAtomicoInteiro(&e->ociosas, 1) + 1 == lerAtomicoInteiro(&e->ativas)) {
+                    compararETrocarInteiro(&e->terminada, 0, 1);
+                }
+            }
+            abrirTrinco(&e->trincoTarefas);
+        }
+        cederProcessador();
+    }
+    return NULL;
+}
+
+/**
+ * @brief Cede s threads ociosas os candidatos do fundo da pilha, enquanto houver
+ * mais threads ociosas do que prefixos na lista e restar pelo menos um candidato.
+ *
+ * Um candidato com profundidade d tem o pai na posio d - 1 do caminho corrente, pelo
+ * que o seu prefixo  caminho[0..d-1] seguido dele.
+ */
+static void cederCandidatos(Explorador* x, Enumeracao* e) {
+    while (x->numCandidatos > 1 &&
+        lerAtomicoInteiro(&e->ociosas) > lerAtomicoInteiro(&e->pendentes)) {
+        Vertice* w = x->candidatos[0];
+        int profundidade = x->profundidades[0];
+        if (publicarPrefixo(e, x->caminho->caminho, profundidade, w) != 0) return;
+
+        x->numCandidatos--;
+        memmove(x->candidatos, x->candidatos + 1, (size_t)x->numCandidatos * sizeof(Vertice*));
+        memmove(x->profundidades, x->profundidades + 1, (size_t)x->numCandidatos * sizeof(int));
+    }
+}
+
+/**
+ * @brief Explora todos os caminhos que comeam por `prefixo`.
+ *
+ * @return 0 se sucesso, -2 se faltar memria.
+ */
+static int explorar(Explorador* x, Enumeracao* e, const int* prefixo, int comprimento) {
+    ContextoProcura* c = x->caminho;
+    iniciarProcura(c, e->grafo);
+    for (int i = 0; i < comprimento; i++) {
+        c->caminho[i] = e->grafo->porIndice[prefixo[i]];
+        marcarVisitado(c, c->caminho[i]);
+    }
+    int pos = comprimento - 1;
+    if (c->caminho[pos] == e->destino) {
+        entregar(e, c->caminho, comprimento);
+        return 0;
+    }
+
+    x->numCandidatos = 0;
+    if (expandir(x, e, pos) != 0) return -2;
+
+    while (x->numCandidatos > 0) {
+        if (lerAtomicoInteiro(&e->parar)) break;
+        if (e->paralelo) cederCandidatos(x, e);
+        x->numCandidatos--;
+        Vertice* w = x->candidatos[x->numCandidatos];
+        int profundidade = x->profundidades[x->numCandidatos];
+
+        while (pos >= profundidade) {  // voltar atrs at ao pai do candidato
+            desmarcarVisitado(c, c->caminho[pos]);
+            pos--;
+        }
+        c->caminho[++pos] = w;
+        marcarVisitado(c, w);
+
+        if (w == e->destino) {
+            if (entregar(e, c->caminho, pos + 1)) break;
+        }
+        else if (expandir(x, e, pos) != 0) {
+            return -2;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Tarefa de cada thread: explora prefixos da lista at a enumerao terminar.
+ */
+static void tarefaEnumeracao(void* dados, int indiceThread, int numThreads) {
+    (void)indiceThread;
+    (void)numThreads;
+    Enumeracao* e = dados;
+    somarAtomicoInteiro(&e->ativas, 1);
+
+    Explorador x;
+    int ok = criarExplorador(&x, e->grafo) == 0;
+    int* prefixo;
+    while ((prefixo = obterPrefixo(e)) != NULL) {
+        if (ok) ok = explorar(&x, e, prefixo + 1, prefixo[0]) == 0;
+        free(prefixo);
+        if (!ok) {
+            compararETrocarInteiro(&e->erro, 0, 1);
+            pararEnumeracao(e);
+        }
+    }
+    libertarExplorador(&x);
+}
+
+/**
+ * @brief Enumera os caminhos simples entre dois vrtices.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @param limites Limites da enumerao, ou NULL.
+ * @param visitante Funo chamada para cada caminho.
+ * @param dados Apontador passado ao visitante.
+ * @param numThreads Nmero de threads (<= 0 usa o nmero de processadores).
+ * @return Nmero de caminhos entregues, ou -1 em caso de erro.
+ */
+int enumerarCaminhos(const GR* grafo, Vertice* origem, Vertice* destino, const LimitesCaminhos* limites,
+    VisitanteCaminho visitante, void* dados, int numThreads) {
+    if (!grafo || !origem || !destino || !visitante || origem->indice < 0 || destino->indice < 0) return -1;
+    if (numThreads <= 0) numThreads = numeroProcessadores();
+
+    Enumeracao e;
+    memset(&e, 0, sizeof(e));
+    e.grafo = grafo;
+    e.destino = destino;
+    e.comprimentoMaximo = limites ? limites->comprimentoMaximo : 0;
+    e.maxCaminhos = limites ? limites->maxCaminhos : 0;
+    e.visitante = visitante;
+    e.dados = dados;
+    e.paralelo = numThreads > 1;
+    if (e.comprimentoMaximo < 0 || e.maxCaminhos < 0) return -1;
+
+    int resultado = 0;
+    if (numThreads == 1) {
+        Explorador x;
+        resultado = criarExplorador(&x, grafo);
+        if (resultado == 0) resultado = explorar(&x, &e, &origem->indice, 1);
+        libertarExplorador(&x);
+    }
+    else {
+        resultado = publicarPrefixo(&e, NULL, 0, origem);
+        if (resultado == 0) executarEmParalelo(tarefaEnumeracao, &e, numThreads);
+        for (int i = 0; i < e.numTarefas; i++) {  // prefixos que ficaram por explorar (paragem)
+            free(e.tarefas[i]);
+        }
+        free(e.tarefas);
+    }
+
+    if (resultado != 0 || e.erro) return -1;
+    return e.entregues;
+}
@@ -0,0 +1,50 @@
+#ifndef FUNCOESENUMERACAO_H
+#define FUNCOESENUMERACAO_H
+
+/**
+ * @file FuncoesEnumeracao.h
+ * @brief Declarao do motor de enumerao de caminhos simples entre dois vrtices.
+ *
+ * Ao contrrio de `encontrarTodosCaminhos`, o caminho corrente no tem tamanho fixo, a
+ * procura no  recursiva, os caminhos so entregues a um visitante e os ramos que j
+ * no podem chegar ao destino so cortados antes de serem explorados.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "Structs.h"
+#include "FuncoesBusca.h"
+
+ /**
+  * @brief Enumera os caminhos simples entre dois vrtices, em vrias threads.
+  *
+  * Antes de explorar os vizinhos de um vrtice do caminho, uma procura em largura a
+  * partir do destino, sem passar pelo caminho corrente, indica quais deles ainda chegam
+  * ao destino (dentro do comprimento mximo, se houver). Cada ramo explorado d pelo
+  * menos um caminho, mas cada vrtice expandido custa uma procura na parte da componente
+  * do destino ao alcance do comprimento restante: em componentes grandes deve indicar-se
+  * um comprimento mximo. As arestas devem ser simtricas, como as criadas por
+  * `criarArestasAdjacentes`.
+  *
+  * Com mais de uma thread, o trabalho  distribudo por roubo: as threads ocupadas cedem
+  * s ociosas os ramos menos profundos ainda por explorar, pelo que um ramo pesado 
+  * repartido por todas; a ordem dos caminhos deixa de ser a da procura em profundidade. O visitante nunca  chamado por duas threads ao
+  * mesmo tempo.
+  *
+  * @param grafo Apontador para o grafo.
+  * @param origem Apontador para o vrtice de partida.
+  * @param destino Apontador para o vrtice de chegada.
+  * @param limites Limites da enumerao (NULL = sem limites).
+  * @param visitante Funo chamada para cada caminho; se devolver um valor positivo, a
+  *        enumerao pra; se devolver um valor negativo, pra e devolve -1.
+  * @param dados Apontador passado ao visitante.
+  * @param numThreads Nmero de threads (<= 0 usa o nmero de processadores).
+  * @return Nmero de caminhos entregues, ou -1 se parmetros invlidos, faltar memria ou o
+  *         visitante falhar.
+  */
+int enumerarCaminhos(const GR* grafo, Vertice* origem, Vertice* destino, const LimitesCaminhos* limites,
+    VisitanteCaminho visitante, void* dados, int numThreads);
+
+#endif // FUNCOESENUMERACAO_H
@@ -11,17 +11,252 @@
  * onde cada caractere representa um vrtice ou espao vazio ('.').
  * Os vrtices so criados e adicionados ao grafo com posies e identificadores nicos.
  *
+ * O ficheiro  mapeado em memria (`mmap` em POSIX, `MapViewOfFile` em Windows) e as
+ * linhas so percorridas diretamente sobre o contedo mapeado, sem cpias nem limite
+ * de comprimento de linha. Se o mapeamento no for possvel, o ficheiro  lido de uma
+ * s vez para um buffer. As clulas vazias so saltadas com comparaes vetoriais
+ * (ver FuncoesSimd.c), pelo que s as antenas e as quebras de linha so tratadas uma a uma.
+ *
  * @author Duarte "macrogod" Pereira
  * @date 2025-05-18
  * @version 1.0
  */
 
+#define _CRT_SECURE_NO_WARNINGS
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "FuncoesFicheiro.h"
 #include "FuncoesVertice.h"
 #include "FuncoesGrafo.h"
+#include "FuncoesIndice.h"
+#include "FuncoesComponentes.h"
+#include "FuncoesMemoria.h"
+#include "FuncoesThreads.h"
+#include "FuncoesSimd.h"
+
+#define TAMANHO_MINIMO_PEDACO (1 << 16)
+
+/**
+ * @brief Antena encontrada por uma thread, com a linha relativa ao incio do seu pedao.
+ */
+typedef struct CelulaLida {
+    int x;               /**< Coluna da antena */
+    int linha;           /**< Linha dentro do pedao */
+    char frequencia;     /**< Frequncia da antena */
+} CelulaLida;
+
+/**
+ * @brief Parte do ficheiro processada por uma thread, sempre alinhada ao incio de uma linha.
+ */
+typedef struct PedacoMapa {
+    const char* inicio;  /**< Primeiro byte do pedao */
+    const char* fim;     /**< Byte seguinte ao ltimo do pedao */
+    CelulaLida* celulas; /**< Antenas encontradas no pedao */
+    size_t numCelulas;   /**< Nmero de antenas encontradas */
+    int numLinhas;       /**< Nmero de linhas do pedao */
+    int maxColunas;      /**< Comprimento da maior linha do pedao */
+    int linhaBase;       /**< Linha global da primeira linha do pedao */
+    size_t celulaBase;   /**< Posio global da primeira antena do pedao */
+    int erro;            /**< Diferente de 0 se a thread falhou */
+} PedacoMapa;
+
+/**
+ * @brief Estado partilhado pelas threads do carregamento paralelo.
+ */
+typedef struct CarregamentoParalelo {
+    GR* grafo;           /**< Grafo a preencher */
+    PedacoMapa* pedacos; /**< Um pedao por thread */
+    Vertice* vertices;   /**< Vetor contguo com todos os vrtices novos */
+    size_t totalCelulas; /**< Nmero total de antenas */
+    int idBase;          /**< ID da primeira antena */
+} CarregamentoParalelo;
+
+/**
+ * @brief Tenta mapear o ficheiro em memria.
+ *
+ * @param copia 0 para um mapeamento s de leitura, 1 para uma cpia privada em que as
+ *        pginas escritas so copiadas (copy-on-write) sem alterar o ficheiro.
+ * @return 0 se mapeou (ou se o ficheiro est vazio), -1 caso contrrio.
+ */
+static int mapearFicheiroSistema(const char* nomeFicheiro, FicheiroMapeado* f, int copia) {
+#ifdef _WIN32
+    HANDLE ficheiro = CreateFileA(nomeFicheiro, GENERIC_READ, FILE_SHARE_READ, NULL,
+        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (ficheiro == INVALID_HANDLE_VALUE) return -1;
+
+    LARGE_INTEGER tamanho;
+    if (!GetFileSizeEx(ficheiro, &tamanho)) {
+        CloseHandle(ficheiro);
+        return -1;
+    }
+    if (tamanho.QuadPart == 0) {
+        CloseHandle(ficheiro);
+        f->dados = NULL;
+        f->tamanho = 0;
+        f->mapeado = 1;
+        return 0;
+    }
+
+    HANDLE mapa = CreateFileMappingA(ficheiro, NULL, copia ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(ficheiro);
+    if (!mapa) return -1;
+    void* dados = MapViewOfFile(mapa, copia ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapa);  // a vista mantm o mapeamento vivo
+    if (!dados) return -1;
+
+    f->dados = dados;
+    f->tamanho = (size_t)tamanho.QuadPart;
+    f->mapeado = 1;
+    return 0;
+#else
+    int fd = open(nomeFicheiro, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        close(fd);
+        return -1;
+    }
+    if (info.st_size == 0) {
+        close(fd);
+        f->dados = NULL;
+        f->tamanho = 0;
+        f->mapeado = 1;
+        return 0;
+    }
+
+    int protecao = copia ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* dados = mmap(NULL, (size_t)info.st_size, protecao, MAP_PRIVATE, fd, 0);
+    close(fd);  // o mapeamento mantm-se depois de fechar o descritor
+    if (dados == MAP_FAILED) return -1;
+#ifdef MADV_SEQUENTIAL
+    madvise(dados, (size_t)info.st_size, MADV_SEQUENTIAL);
+#endif
+
+    f->dados = dados;
+    f->tamanho = (size_t)info.st_size;
+    f->mapeado = 1;
+    return 0;
+#endif
+}
+
+/**
+ * @brief L o ficheiro inteiro para um buffer, com uma nica leitura em bloco.
+ *
+ * @return 0 se sucesso, -1 se no conseguiu abrir ou ler o ficheiro.
+ */
+static int lerFicheiroCompleto(const char* nomeFicheiro, FicheiroMapeado* f) {
+    FILE* ficheiro = fopen(nomeFicheiro, "rb");
+    if (!ficheiro) return -1;
+
+    size_t capacidade = 1 << 16, tamanho = 0;
+    char* dados = malloc(capacidade);
+    while (dados) {
+        tamanho += fread(dados + tamanho, 1, capacidade - tamanho, ficheiro);
+        if (tamanho < capacidade) break;
+        char* novo = realloc(dados, capacidade * 2);
+        if (!novo) {
+            free(dados);
+            dados = NULL;
+            break;
+        }
+        dados = novo;
+        capacidade *= 2;
+    }
+    int erro = !dados || ferror(ficheiro);
+    fclose(ficheiro);
+    if (erro) {
+        free(dados);
+        return -1;
+    }
+
+    f->dados = dados;
+    f->tamanho = tamanho;
+    f->mapeado = 0;
+    return 0;
+}
+
+/**
+ * @brief Disponibiliza o contedo de um ficheiro em memria.
+ *
+ * Tenta primeiro mapear o ficheiro; se no for possvel (por exemplo, num pipe ou
+ * sistema de ficheiros sem suporte), l-o de uma s vez para um buffer.
+ *
+ * @param nomeFicheiro Nome do ficheiro.
+ * @param f Estrutura a preencher.
+ * @return 0 em sucesso, -1 se parmetros invlidos, -2 se o ficheiro no puder ser lido.
+ */
+int mapearFicheiro(const char* nomeFicheiro, FicheiroMapeado* f) {
+    if (!nomeFicheiro || !f) return -1;
+    if (mapearFicheiroSistema(nomeFicheiro, f, 0) == 0) return 0;
+    if (lerFicheiroCompleto(nomeFicheiro, f) == 0) return 0;
+    return -2;
+}
+
+/**
+ * @brief Disponibiliza o contedo de um ficheiro numa cpia privada que pode ser alterada.
+ *
+ * Igual a `mapearFicheiro`, mas o mapeamento  copy-on-write: s as pginas escritas
+ * so copiadas e o ficheiro nunca  alterado. Se no for possvel mapear, o contedo 
+ * lido para um buffer, que tambm pode ser escrito.
+ *
+ * @param nomeFicheiro Nome do ficheiro.
+ * @param f Estrutura a preencher.
+ * @return 0 em sucesso, -1 se parmetros invlidos, -2 se o ficheiro no puder ser lido.
+ */
+int mapearFicheiroPrivado(const char* nomeFicheiro, FicheiroMapeado* f) {
+    if (!nomeFicheiro || !f) return -1;
+    if (mapearFicheiroSistema(nomeFicheiro, f, 1) == 0) return 0;
+    if (lerFicheiroCompleto(nomeFicheiro, f) == 0) return 0;
+    return -2;
+}
+
+/**
+ * @brief Liberta o contedo obtido com `mapearFicheiro`.
+ *
+ * @param f Estrutura preenchida por `mapearFicheiro`.
+ */
+void desmapearFicheiro(FicheiroMapeado* f) {
+    if (!f || !f->dados) return;
+    if (f->mapeado) {
+#ifdef _WIN32
+        UnmapViewOfFile(f->dados);
+#else
+        munmap((void*)f->dados, f->tamanho);
+#endif
+    }
+    else {
+        free((void*)f->dados);
+    }
+    f->dados = NULL;
+    f->tamanho = 0;
+}
+
+/**
+ * @brief Indica se o caractere em `p` termina uma linha ("\n", ou "\r" seguido de "\n" ou do fim).
+ */
+static int fimDeLinha(const char* p, const char* fim) {
+    return *p == '\n' || (*p == '\r' && (p + 1 == fim || p[1] == '\n'));
+}
+
+/**
+ * @brief Avana para o incio da linha seguinte, a partir do fim de linha em `p` (ou de `fim`).
+ */
+static const char* saltarFimDeLinha(const char* p, const char* fim) {
+    if (p < fim && *p == '\r') p++;
+    return p < fim ? p + 1 : fim;
+}
 
  /**
   * @brief Carrega um mapa a partir de um ficheiro para um grafo.
@@ -43,13 +278,19 @@
   * - -3 se falhar a criar um vrtice,
   * - -4 se falhar a adicionar um vrtice ao grafo.
   *
+  * @details
+  * O ficheiro  percorrido duas vezes sobre o contedo mapeado: a primeira passagem conta
+  * as antenas para reservar de uma vez o pool de vrtices e os ndices do grafo; a segunda
+  * salta de antena em antena com `proximaCelulaOcupada` e cria os vrtices. As linhas
+  * podem ter qualquer comprimento e os finais de linha "\r\n" so tratados como "\n".
+  *
   * @note O ficheiro deve estar no formato correto, sem linhas vazias ou caracteres invlidos.
   */
 int carregarMapaNoGrafo(GR* grafo, const char* nomeFicheiro) {
     if (!grafo || !nomeFicheiro) return -1;
 
-    FILE* f = fopen(nomeFicheiro, "r");
-    if (!f) {
+    FicheiroMapeado f;
+    if (mapearFicheiro(nomeFicheiro, &f) != 0) {
         perror("Erro ao abrir ficheiro");
         return -2;
     }
@@ -58,37 +299,273 @@ int carregarMapaNoGrafo(GR* grafo, const char* nomeFicheiro) {
     grafo->colunas = 0;
     int idAtual = grafo->numVertices + 1;  // continuar o ID a partir do que j existe
 
-    char buffer[256];
-    while (fgets(buffer, sizeof(buffer), f)) {
-        size_t len = strlen(buffer);
+    // primeira passagem: reservar memria para todas as antenas de uma vez
+    size_t numAntenas = contarCelulasOcupadas(f.dados, f.tamanho);
+    if (reservarPool(&grafo->poolVertices, numAntenas) != 0 ||
+        reservarIndiceCoordenadas(grafo, grafo->numVertices + (int)numAntenas) != 0 ||
+        reservarIndiceIds(grafo, idAtual + (int)numAntenas) != 0 ||
+        reservarIndiceDenso(grafo, grafo->numVertices + (int)numAntenas) != 0) {
+        desmapearFicheiro(&f);
+        return -3;
+    }
+
+    const char* fim = f.dados + f.tamanho;
+    const char* inicioLinha = f.dados;
+    const char* p = f.dados;
+    while (inicioLinha < fim) {
+        p = proximaCelulaOcupada(p, fim);
 
-        if (len > 0 && buffer[len - 1] == '\n') {
-            buffer[len - 1] = '\0';
-            len--;
+        if (p == fim || fimDeLinha(p, fim)) {
+            int len = (int)(p - inicioLinha);
+            if (len > grafo->colunas) {
+                grafo->colunas = len;
+            }
+            grafo->linhas++;
+            p = inicioLinha = saltarFimDeLinha(p, fim);
+            continue;
+        }
+
+        Vertice* v = criarVertice(grafo, idAtual++, *p, (int)(p - inicioLinha), grafo->linhas);
+        if (!v) {
+            desmapearFicheiro(&f);
+            return -3;  // falha a criar vrtice
+        }
+        if (adicionarVertice(grafo, v) != 0) {
+            libertarVertice(grafo, v);
+            desmapearFicheiro(&f);
+            return -4;  // falha a adicionar vrtice
+        }
+        p++;
+    }
+
+    desmapearFicheiro(&f);
+    return 0;  // sucesso
+}
+
+/**
+ * @brief Percorre as linhas de um pedao e conta as suas antenas.
+ *
+ * Se `celulas` no for NULL, guarda tambm as antenas, o nmero de linhas e o comprimento
+ * da maior linha. A contagem e a leitura passam pelo mesmo ciclo, com o mesmo teste para
+ * aceitar uma clula, pelo que um vetor reservado com a contagem tem sempre espao para
+ * todas as antenas guardadas.
+ *
+ * @param p Pedao a percorrer.
+ * @param celulas Vetor onde guardar as antenas, ou NULL para s contar.
+ * @return Nmero de antenas do pedao.
+ */
+static size_t percorrerPedaco(PedacoMapa* p, CelulaLida* celulas) {
+    size_t numCelulas = 0;
+    int numLinhas = 0;
+    const char* inicioLinha = p->inicio;
+    const char* atual = p->inicio;
+    while (inicioLinha < p->fim) {
+        atual = proximaCelulaOcupada(atual, p->fim);
+
+        if (atual == p->fim || fimDeLinha(atual, p->fim)) {
+            int len = (int)(atual - inicioLinha);
+            if (celulas && len > p->maxColunas) {
+                p->maxColunas = len;
+            }
+            numLinhas++;
+            atual = inicioLinha = saltarFimDeLinha(atual, p->fim);
+            continue;
         }
 
-        if ((int)len > grafo->colunas) {
-            grafo->colunas = (int)len;
+        if (celulas) {
+            CelulaLida* cel = &celulas[numCelulas];
+            cel->x = (int)(atual - inicioLinha);
+            cel->linha = numLinhas;
+            cel->frequencia = *atual;
         }
+        numCelulas++;
+        atual++;
+    }
+    if (celulas) p->numLinhas = numLinhas;
+    return numCelulas;
+}
+
+/**
+ * @brief Primeira fase paralela: cada thread percorre o seu pedao e guarda as antenas.
+ *
+ * As antenas so guardadas com a linha relativa ao pedao, porque a linha global
+ * s  conhecida depois de todas as threads terem contado as suas linhas.
+ */
+static void lerPedacoMapa(void* dados, int indiceThread, int numThreads) {
+    (void)numThreads;
+    CarregamentoParalelo* c = dados;
+    PedacoMapa* p = &c->pedacos[indiceThread];
+
+    size_t n = percorrerPedaco(p, NULL);
+    p->celulas = malloc((n > 0 ? n : 1) * sizeof(CelulaLida));
+    if (!p->celulas) {
+        p->erro = 1;
+        return;
+    }
+    p->numCelulas = percorrerPedaco(p, p->celulas);
+}
+
+/**
+ * @brief Segunda fase paralela: cada thread cria os vrtices das suas antenas.
+ *
+ * Os vrtices ficam num vetor contguo do pool, pela ordem do ficheiro, pelo que a
+ * ligao `next`/`prev` de cada um  simplesmente o vizinho no vetor. Cada thread
+ * escreve ainda as suas posies nas tabelas de IDs e de ndices densos (posies
+ * distintas) e insere os vrtices na tabela de coordenadas com compare-and-swap.
+ */
+static void criarVerticesPedaco(void* dados, int indiceThread, int numThreads) {
+    (void)numThreads;
+    CarregamentoParalelo* c = dados;
+    PedacoMapa* p = &c->pedacos[indiceThread];
+    GR* grafo = c->grafo;
+
+    for (size_t i = 0; i < p->numCelulas; i++) {
+        size_t global = p->celulaBase + i;
+        Vertice* v = &c->vertices[global];
+        v->id = c->idBase + (int)global;
+        v->frequencia = p->celulas[i].frequencia;
+        v->x = p->celulas[i].x;
+        v->y = p->linhaBase + p->celulas[i].linha;
+        v->visitado = 0;
+        v->indice = (int)global;
+        v->adj = NULL;
+        v->prev = global > 0 ? v - 1 : NULL;
+        v->next = global + 1 < c->totalCelulas ? v + 1 : NULL;
+
+        grafo->indiceId[v->id] = v;
+        grafo->porIndice[global] = v;
+        if (indexarCoordenadasConcorrente(grafo, v) != 0) {
+            p->erro = 1;
+        }
+    }
+}
 
-        for (int x = 0; x < (int)len; x++) {
-            char c = buffer[x];
-            if (c != '.') {
-                Vertice* v = criarVertice(idAtual++, c, x, grafo->linhas);
+/**
+ * @brief Carrega um mapa para um grafo vazio usando vrias threads.
+ *
+ * O ficheiro mapeado  dividido em pedaos alinhados ao incio das linhas, um por thread.
+ * Cada thread l as antenas do seu pedao para um buffer prprio; depois, com somas
+ * prefixas do nmero de linhas e de antenas de cada pedao, cada antena recebe a sua
+ * linha global e um ID sequencial, iguais aos que `carregarMapaNoGrafo` atribuiria.
+ * A criao dos vrtices e o preenchimento dos ndices tambm so feitos em paralelo.
+ *
+ * Se o grafo j tiver vrtices, os novos vrtices so adicionados pela via sequencial
+ * (`adicionarVertice`), que verifica colises com os vrtices existentes.
+ *
+ * @param grafo Apontador para o grafo onde os vrtices sero adicionados.
+ * @param nomeFicheiro Nome do ficheiro de texto a ser lido.
+ * @param numThreads Nmero de threads (se <= 0, usa o nmero de processadores).
+ * @return Os mesmos cdigos de `carregarMapaNoGrafo`.
+ */
+int carregarMapaNoGrafoParalelo(GR* grafo, const char* nomeFicheiro, int numThreads) {
+    if (!grafo || !nomeFicheiro) return -1;
+
+    FicheiroMapeado f;
+    if (mapearFicheiro(nomeFicheiro, &f) != 0) {
+        perror("Erro ao abrir ficheiro");
+        return -2;
+    }
+
+    if (numThreads <= 0) numThreads = numeroProcessadores();
+    if ((size_t)numThreads > f.tamanho / TAMANHO_MINIMO_PEDACO) {
+        numThreads = (int)(f.tamanho / TAMANHO_MINIMO_PEDACO);  // pedaos demasiado pequenos no compensam
+    }
+    if (numThreads < 1) numThreads = 1;
+
+    CarregamentoParalelo c;
+    c.grafo = grafo;
+    c.vertices = NULL;
+    c.totalCelulas = 0;
+    c.idBase = grafo->numVertices + 1;
+    c.pedacos = calloc((size_t)numThreads, sizeof(PedacoMapa));
+    if (!c.pedacos) {
+        desmapearFicheiro(&f);
+        return -3;
+    }
+
+    // dividir o ficheiro em pedaos que comeam sempre no incio de uma linha
+    const char* fim = f.dados + f.tamanho;
+    const char* inicio = f.dados;
+    for (int t = 0; t < numThreads; t++) {
+        const char* corte = t + 1 < numThreads ? f.dados + f.tamanho / (size_t)numThreads * (size_t)(t + 1) : fim;
+        if (corte < inicio) corte = inicio;
+        if (corte < fim) {
+            const char* nl = memchr(corte, '\n', (size_t)(fim - corte));
+            corte = nl ? nl + 1 : fim;
+        }
+        c.pedacos[t].inicio = inicio;
+        c.pedacos[t].fim = corte;
+        inicio = corte;
+    }
+
+    nivelSimd();  // escolher a verso vetorial antes de lanar as threads
+    executarEmParalelo(lerPedacoMapa, &c, numThreads);
+
+    int resultado = 0;
+    int linhas = 0, colunas = 0;
+    for (int t = 0; t < numThreads; t++) {
+        PedacoMapa* p = &c.pedacos[t];
+        if (p->erro) resultado = -3;
+        p->linhaBase = linhas;
+        p->celulaBase = c.totalCelulas;
+        linhas += p->numLinhas;
+        c.totalCelulas += p->numCelulas;
+        if (p->maxColunas > colunas) colunas = p->maxColunas;
+    }
+
+    if (resultado == 0 && grafo->numVertices == 0 && c.totalCelulas > 0) {
+        c.vertices = alocarVetorDoPool(&grafo->poolVertices, c.totalCelulas);
+        if (!c.vertices ||
+            reservarIndiceCoordenadas(grafo, (int)c.totalCelulas) != 0 ||
+            reservarIndiceIds(grafo, c.idBase + (int)c.totalCelulas) != 0 ||
+            reservarIndiceDenso(grafo, (int)c.totalCelulas) != 0) {
+            resultado = -3;
+        }
+        else {
+            executarEmParalelo(criarVerticesPedaco, &c, numThreads);
+            for (int t = 0; t < numThreads; t++) {
+                if (c.pedacos[t].erro) resultado = -4;
+            }
+            grafo->vertices = &c.vertices[0];
+            grafo->ultimo = &c.vertices[c.totalCelulas - 1];
+            grafo->numVertices = (int)c.totalCelulas;
+            invalidarComponentes(grafo);  // vrtices criados sem passar por adicionarVertice
+            grafo->versao++;
+        }
+    }
+    else if (resultado == 0) {
+        // grafo com vrtices: juno sequencial, que deteta colises
+        if (reservarIndiceCoordenadas(grafo, grafo->numVertices + (int)c.totalCelulas) != 0 ||
+            reservarIndiceIds(grafo, c.idBase + (int)c.totalCelulas) != 0 ||
+            reservarIndiceDenso(grafo, grafo->numVertices + (int)c.totalCelulas) != 0) {
+            resultado = -3;
+        }
+        int id = c.idBase;
+        for (int t = 0; t < numThreads && resultado == 0; t++) {
+            PedacoMapa* p = &c.pedacos[t];
+            for (size_t i = 0; i < p->numCelulas; i++) {
+                CelulaLida* cel = &p->celulas[i];
+                Vertice* v = criarVertice(grafo, id++, cel->frequencia, cel->x, p->linhaBase + cel->linha);
                 if (!v) {
-                    fclose(f);
-                    return -3;  // falha a criar vrtice
+                    resultado = -3;
+                    break;
                 }
                 if (adicionarVertice(grafo, v) != 0) {
-                    free(v);
-                    fclose(f);
-                    return -4;  // falha a adicionar vrtice
+                    libertarVertice(grafo, v);
+                    resultado = -4;
+                    break;
                 }
             }
         }
-        grafo->linhas++;
     }
 
-    fclose(f);
-    return 0;  // sucesso
-}
\ No newline at end of file
+    grafo->linhas = linhas;
+    grafo->colunas = colunas;
+
+    for (int t = 0; t < numThreads; t++) {
+        free(c.pedacos[t].celulas);
+    }
+    free(c.pedacos);
+    desmapearFicheiro(&f);
+    return resultado;
+}
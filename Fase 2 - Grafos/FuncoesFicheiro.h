@@ -3,7 +3,7 @@
 
 /**
  * @file FuncoesFicheiro.h
- * @brief Declarao da funo para carregar um mapa de antenas a partir de ficheiro para o grafo.
+ * @brief Declarao das funes para carregar um mapa de antenas a partir de ficheiro para o grafo.
  *
  * Contm a funo que l um ficheiro de texto com a representao do mapa e cria os vrtices
  * correspondentes no grafo.
@@ -16,16 +16,56 @@
 #include "Structs.h"
 
  /**
-  * @brief Carrega o mapa de antenas de um ficheiro de texto para o grafo.
+  * @brief Disponibiliza o contedo de um ficheiro em memria, mapeando-o ou lendo-o de uma s vez.
   *
-  * L um ficheiro onde cada linha representa uma linha do mapa e cada caractere uma clula.
-  * Cria vrtices no grafo para cada antena detectada (carcter diferente de '.').
-  * Atualiza as dimenses do grafo (linhas e colunas) e o nmero de vrtices.
-  *
-  * @param grafo Apontador para o grafo onde os vrtices sero adicionados.
-  * @param nomeFicheiro Nome do ficheiro a ler.
-  * @return int 0 em sucesso, -1 em caso de erro (ex: ficheiro no encontrado).
+  * @param nomeFicheiro Nome do ficheiro.
+  * @param f Estrutura a preencher com o contedo e o seu tamanho.
+  * @return int 0 em sucesso, -1 se parmetros invlidos, -2 se o ficheiro no puder ser lido.
   */
+int mapearFicheiro(const char* nomeFicheiro, FicheiroMapeado* f);
+
+/**
+ * @brief Como `mapearFicheiro`, mas o contedo pode ser escrito: o mapeamento  uma
+ * cpia privada (copy-on-write) e o ficheiro nunca  alterado.
+ *
+ * @param nomeFicheiro Nome do ficheiro.
+ * @param f Estrutura a preencher com o contedo e o seu tamanho.
+ * @return int 0 em sucesso, -1 se parmetros invlidos, -2 se o ficheiro no puder ser lido.
+ */
+int mapearFicheiroPrivado(const char* nomeFicheiro, FicheiroMapeado* f);
+
+/**
+ * @brief Liberta o contedo obtido com `mapearFicheiro` ou `mapearFicheiroPrivado`.
+ *
+ * @param f Estrutura preenchida por `mapearFicheiro`.
+ */
+void desmapearFicheiro(FicheiroMapeado* f);
+
+/**
+ * @brief Carrega o mapa de antenas de um ficheiro de texto para o grafo.
+ *
+ * L um ficheiro onde cada linha representa uma linha do mapa e cada caractere uma clula.
+ * Cria vrtices no grafo para cada antena detectada (carcter diferente de '.').
+ * Atualiza as dimenses do grafo (linhas e colunas) e o nmero de vrtices.
+ * As linhas podem ter qualquer comprimento.
+ *
+ * @param grafo Apontador para o grafo onde os vrtices sero adicionados.
+ * @param nomeFicheiro Nome do ficheiro a ler.
+ * @return int 0 em sucesso, -1 em caso de erro (ex: ficheiro no encontrado).
+ */
 int carregarMapaNoGrafo(GR* grafo, const char* nomeFicheiro);
 
+/**
+ * @brief Carrega o mapa de antenas de um ficheiro de texto para o grafo usando vrias threads.
+ *
+ * Produz o mesmo grafo que `carregarMapaNoGrafo` (mesmas coordenadas, IDs e dimenses),
+ * dividindo o ficheiro em pedaos alinhados s linhas que so lidos em paralelo.
+ *
+ * @param grafo Apontador para o grafo onde os vrtices sero adicionados.
+ * @param nomeFicheiro Nome do ficheiro a ler.
+ * @param numThreads Nmero de threads a usar (se <= 0, usa o nmero de processadores).
+ * @return int 0 em sucesso, valor negativo em caso de erro (os mesmos de `carregarMapaNoGrafo`).
+ */
+int carregarMapaNoGrafoParalelo(GR* grafo, const char* nomeFicheiro, int numThreads);
+
 #endif // FUNCOESFICHEIRO_H
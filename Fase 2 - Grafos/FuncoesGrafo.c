@@ -23,6 +23,9 @@
 #include "FuncoesGrafo.h"
 #include "FuncoesVertice.h"
 #include "FuncoesAresta.h"
+#include "FuncoesIndice.h"
+#include "FuncoesMemoria.h"
+#include "FuncoesComponentes.h"
 
  /**
   * @brief Cria um grafo vazio e inicializa os seus campos.
@@ -37,9 +40,24 @@ GR* criarGrafo() {
         exit(1);
     }
     grafo->vertices = NULL;
+    grafo->ultimo = NULL;
     grafo->numVertices = 0;
     grafo->linhas = 0;
     grafo->colunas = 0;
+    grafo->indiceCoord = NULL;
+    grafo->capacidadeCoord = 0;
+    grafo->indiceId = NULL;
+    grafo->capacidadeId = 0;
+    grafo->porIndice = NULL;
+    grafo->capacidadeDenso = 0;
+    grafo->componentes.pai = NULL;
+    grafo->componentes.tamanho = NULL;
+    grafo->componentes.capacidade = 0;
+    grafo->componentes.numComponentes = 0;
+    grafo->componentes.valida = 0;  // construda com as arestas ou na primeira consulta
+    grafo->versao = 0;
+    iniciarPool(&grafo->poolVertices, sizeof(Vertice), 256);
+    iniciarPool(&grafo->poolArestas, sizeof(Aresta), 1024);
     return grafo;
 }
 
@@ -102,6 +120,9 @@ void imprimirMapa(GR* grafo) {
 /**
  * @brief Liberta toda a memria alocada para o grafo, incluindo vrtices e arestas.
  *
+ * Como vrtices e arestas vivem nos pools do grafo, no  preciso percorrer as listas:
+ * cada pool  libertado com uma chamada a `free` por bloco.
+ *
  * @param grafo Apontador para o grafo a libertar.
  * @return 0 se for bem sucedido, -1 se o grafo for NULL.
  *
@@ -110,14 +131,12 @@ void imprimirMapa(GR* grafo) {
 int libertarGrafo(GR* grafo) {
     if (!grafo) return -1;
 
-    Vertice* v = grafo->vertices;
-    while (v) {
-        Vertice* tmpV = v;
-        libertarArestasDoVertice(v);
-        v = v->next;
-        free(tmpV);
-    }
+    libertarPool(&grafo->poolArestas);
+    libertarPool(&grafo->poolVertices);
     grafo->vertices = NULL;
+    grafo->ultimo = NULL;
+    libertarIndices(grafo);
+    libertarComponentes(grafo);
     grafo->numVertices = 0;
     grafo->linhas = 0;
     grafo->colunas = 0;
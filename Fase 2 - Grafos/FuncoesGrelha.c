@@ -0,0 +1,316 @@
+/**
+ * @file FuncoesGrelha.c
+ * @brief Implementao da grelha por frequncia e da procura Jump Point Search.
+ *
+ * @details
+ * A procura  um A* (distncia octil) em que os sucessores de um ponto de salto so
+ * obtidos por `saltar`: a partir dele avana-se numa direo at encontrar o destino,
+ * uma clula com vizinhos forados (um obstculo ao lado obriga a mudar de direo)
+ * ou, nas diagonais, uma clula de onde um salto reto encontra um ponto de salto.
+ * As direes a tentar de cada ponto so s as naturais (a continuao do movimento)
+ * e as foradas; todas as outras tm um caminho de custo igual ou menor que no passa
+ * pelo ponto. Como no grafo as diagonais no dependem das clulas ortogonais, usam-se
+ * as regras originais do algoritmo, com cortes de canto permitidos.
+ *
+ * O estado da procura (custos, antecessores, heap e marcas)  o do `ContextoProcura`,
+ * indexado pelo ndice denso das antenas, porque cada ponto de salto  uma antena.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "Structs.h"
+#include "FuncoesGrelha.h"
+#include "FuncoesCaminhoMinimo.h"
+#include "FuncoesContexto.h"
+#include "FuncoesHeap.h"
+
+/**
+ * @brief Cria a grelha das antenas de uma frequncia.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param frequencia Frequncia das antenas.
+ * @return Apontador para a grelha, ou NULL se no houver antenas, o retngulo for grande
+ *         demais ou faltar memria.
+ */
+GrelhaFrequencia* criarGrelhaFrequencia(const GR* grafo, char frequencia) {
+    if (!grafo) return NULL;
+
+    // retngulo das antenas (ver FuncoesGrelha.h: as dimenses do grafo no o limitam)
+    int xMin = 0, xMax = -1, yMin = 0, yMax = -1, encontrados = 0;
+    for (int i = 0; i < grafo->numVertices; i++) {
+        const Vertice* v = grafo->porIndice[i];
+        if (v->frequencia != frequencia) continue;
+        if (!encontrados || v->x < xMin) xMin = v->x;
+        if (!encontrados || v->x > xMax) xMax = v->x;
+        if (!encontrados || v->y < yMin) yMin = v->y;
+        if (!encontrados || v->y > yMax) yMax = v->y;
+        encontrados++;
+    }
+    if (!encontrados) return NULL;
+
+    // em int, xMax - xMin + 3 transborda com coordenadas afastadas; as clulas so
+    // endereadas com long, que no Windows tem 32 bits
+    long long largura = (long long)xMax - xMin + 3;   // uma coluna de moldura de cada lado
+    long long altura = (long long)yMax - yMin + 3;
+    if (largura > INT_MAX || altura > INT_MAX || largura > LONG_MAX / altura ||
+        (unsigned long long)(largura * altura) > SIZE_MAX / sizeof(int)) {
+        return NULL;
+    }
+
+    GrelhaFrequencia* g = malloc(sizeof(GrelhaFrequencia));
+    if (!g) return NULL;
+    g->largura = (int)largura;
+    g->altura = (int)altura;
+    g->xMin = xMin;
+    g->yMin = yMin;
+    g->frequencia = frequencia;
+    g->grafo = grafo;
+    g->versaoGrafo = grafo->versao;
+
+    size_t numCelulas = (size_t)(largura * altura);
+    g->celulas = malloc(numCelulas * sizeof(int));
+    if (!g->celulas) {
+        free(g);
+        return NULL;
+    }
+    for (size_t c = 0; c < numCelulas; c++) {
+        g->celulas[c] = -1;
+    }
+    for (int i = 0; i < grafo->numVertices; i++) {
+        const Vertice* v = grafo->porIndice[i];
+        if (v->frequencia != frequencia) continue;
+        g->celulas[(size_t)(v->y - yMin + 1) * g->largura + (v->x - xMin + 1)] = i;
+    }
+    return g;
+}
+
+/**
+ * @brief Liberta a memria de uma grelha.
+ *
+ * @param grelha Apontador para a grelha.
+ */
+void libertarGrelhaFrequencia(GrelhaFrequencia* grelha) {
+    if (!grelha) return;
+    free(grelha->celulas);
+    free(grelha);
+}
+
+/**
+ * @brief Clula da grelha onde est um vrtice, ou -1 se o vrtice no pertencer  grelha.
+ */
+static long celulaDoVertice(const GrelhaFrequencia* g, const Vertice* v) {
+    if (v->frequencia != g->frequencia) return -1;
+    long long cx = (long long)v->x - g->xMin + 1, cy = (long long)v->y - g->yMin + 1;
+    if (cx < 1 || cx >= g->largura - 1 || cy < 1 || cy >= g->altura - 1) return -1;
+    long c = (long)(cy * g->largura + cx);  // cabe em long: ver criarGrelhaFrequencia
+    return g->celulas[c] == v->indice ? c : -1;
+}
+
+/**
+ * @brief Salto reto a partir de `c` com deslocamento `d`; `p`  o deslocamento perpendicular.
+ *
+ * @return Clula do ponto de salto, ou -1 se o salto terminar num obstculo.
+ */
+static long saltarReto(const int* celulas, long c, long d, long p, long alvo, int* passos) {
+    int k = 0;
+    for (;;) {
+        c += d;
+        k++;
+        if (celulas[c] < 0) return -1;
+        if (c == alvo) break;
+        // vizinho forado: o lado est ocupado por um obstculo mas a clula  frente dele no
+        if ((celulas[c + p] < 0 && celulas[c + p + d] >= 0) ||
+            (celulas[c - p] < 0 && celulas[c - p + d] >= 0)) break;
+    }
+    *passos = k;
+    return c;
+}
+
+/**
+ * @brief Salta a partir da clula `c` na direo (dx, dy).
+ *
+ * @param g Apontador para a grelha.
+ * @param c Clula de partida.
+ * @param dx Direo em x (-1, 0 ou 1).
+ * @param dy Direo em y (-1, 0 ou 1).
+ * @param alvo Clula do destino.
+ * @param passos Recebe o nmero de passos at ao ponto de salto.
+ * @return Clula do ponto de salto, ou -1 se no existir nessa direo.
+ */
+static long saltar(const GrelhaFrequencia* g, long c, int dx, int dy, long alvo, int* passos) {
+    const int* celulas = g->celulas;
+    long largura = g->largura;
+    long h = dx;                  // deslocamento horizontal
+    long v = dy * largura;        // deslocamento vertical
+
+    if (dx == 0) return saltarReto(celulas, c, v, 1, alvo, passos);
+    if (dy == 0) return saltarReto(celulas, c, h, largura, alvo, passos);
+
+    int k = 0, ignorar;
+    for (;;) {
+        c += h + v;
+        k++;
+        if (celulas[c] < 0) return -1;
+        if (c == alvo) break;
+        if ((celulas[c - h] < 0 && celulas[c - h + v] >= 0) ||
+            (celulas[c - v] < 0 && celulas[c + h - v] >= 0)) break;
+        // uma diagonal pra onde um dos saltos retos que dela partem encontra um ponto
+        if (saltarReto(celulas, c, h, largura, alvo, &ignorar) >= 0 ||
+            saltarReto(celulas, c, v, 1, alvo, &ignorar) >= 0) break;
+    }
+    *passos = k;
+    return c;
+}
+
+/**
+ * @brief Sinal de um inteiro (-1, 0 ou 1).
+ */
+static int sinal(int a) {
+    return (a > 0) - (a < 0);
+}
+
+/**
+ * @brief Escreve em `ctx->caminho` o caminho clula a clula entre os pontos de salto.
+ *
+ * Os pontos de salto, do destino para a origem, so primeiro copiados para `ctx->fila`;
+ * entre dois pontos consecutivos o caminho  um segmento reto ou diagonal.
+ *
+ * @return Nmero de vrtices do caminho.
+ */
+static int expandirCaminho(ContextoProcura* ctx, const GR* grafo, const GrelhaFrequencia* g, Vertice* destino) {
+    int numPontos = 0;
+    for (int i = destino->indice; i >= 0; i = ctx->pais[i]) {
+        ctx->fila[numPontos++] = grafo->porIndice[i];
+    }
+
+    int n = 0;
+    ctx->caminho[n++] = ctx->fila[numPontos - 1];
+    for (int p = numPontos - 1; p > 0; p--) {
+        const Vertice* a = ctx->fila[p];
+        const Vertice* b = ctx->fila[p - 1];
+        int dx = sinal(b->x - a->x), dy = sinal(b->y - a->y);
+        long c = celulaDoVertice(g, a);
+        long d = dy * (long)g->largura + dx;
+        long fim = celulaDoVertice(g, b);
+        while (c != fim) {
+            c += d;
+            ctx->caminho[n++] = grafo->porIndice[g->celulas[c]];
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief Acrescenta a direo (dx, dy) s direes a tentar a partir de um ponto de salto.
+ *
+ * @return Novo nmero de direes.
+ */
+static int acrescentarDirecao(int direcoes[][2], int numDirecoes, int dx, int dy) {
+    direcoes[numDirecoes][0] = dx;
+    direcoes[numDirecoes][1] = dy;
+    return numDirecoes + 1;
+}
+
+/**
+ * @brief Jump Point Search entre duas antenas da grelha.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param grafo Apontador para o grafo.
+ * @param grelha Apontador para a grelha da frequncia.
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @param custo Recebe o custo do caminho (-1 se no existir), se no for NULL.
+ * @return Nmero de vrtices do caminho, 0 se no existir, -1 em caso de erro ou se a
+ *         grelha estiver desatualizada.
+ */
+int caminhoJPS(ContextoProcura* ctx, const GR* grafo, const GrelhaFrequencia* grelha,
+    Vertice* origem, Vertice* destino, double* custo) {
+    if (!grelha || !origem || !destino || !grafo) return -1;
+    // os ndices densos guardados mudam quando o grafo muda (desindexarDenso)
+    if (grelha->grafo != grafo || grelha->versaoGrafo != grafo->versao) return -1;
+    if (iniciarProcura(ctx, grafo) != 0) return -1;
+    long inicio = celulaDoVertice(grelha, origem);
+    long alvo = celulaDoVertice(grelha, destino);
+    if (inicio < 0 || alvo < 0) return -1;
+
+    const int* celulas = grelha->celulas;
+    HeapIndexado* heap = &ctx->heap;
+    double* custos = ctx->custos;
+    int* pais = ctx->pais;
+    int expandidos = 0, encontrado = 0;
+
+    esvaziarHeap(heap);
+    ctx->epocaCaminho = ctx->epoca;
+    marcarVisitado(ctx, origem);
+    custos[origem->indice] = 0.0;
+    pais[origem->indice] = -1;
+    inserirHeap(heap, origem->indice, distanciaOctil(origem->x - destino->x, origem->y - destino->y), 0.0);
+
+    while (heap->tamanho > 0) {
+        Vertice* v = grafo->porIndice[extrairMinimoHeap(heap)];
+        expandidos++;
+        if (v == destino) {
+            encontrado = 1;
+            break;
+        }
+
+        long c = celulaDoVertice(grelha, v);
+        long largura = grelha->largura;
+        int direcoes[8][2];
+        int numDirecoes = 0;
+
+        if (pais[v->indice] < 0) {  // origem: todas as direes
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    if (dx == 0 && dy == 0) continue;
+                    numDirecoes = acrescentarDirecao(direcoes, numDirecoes, dx, dy);
+                }
+            }
+        }
+        else {
+            const Vertice* pai = grafo->porIndice[pais[v->indice]];
+            int dx = sinal(v->x - pai->x), dy = sinal(v->y - pai->y);
+            long h = dx, vert = dy * largura;
+
+            if (dx != 0 && dy != 0) {
+                numDirecoes = acrescentarDirecao(direcoes, numDirecoes, dx, 0);
+                numDirecoes = acrescentarDirecao(direcoes, numDirecoes, 0, dy);
+                numDirecoes = acrescentarDirecao(direcoes, numDirecoes, dx, dy);
+                if (celulas[c - h] < 0) numDirecoes = acrescentarDirecao(direcoes, numDirecoes, -dx, dy);
+                if (celulas[c - vert] < 0) numDirecoes = acrescentarDirecao(direcoes, numDirecoes, dx, -dy);
+            }
+            else {
+                numDirecoes = acrescentarDirecao(direcoes, numDirecoes, dx, dy);
+                // lados perpendiculares ao movimento bloqueados do diagonais foradas
+                int px = dy != 0, py = dx != 0;
+                long p = py * largura + px;
+                if (celulas[c + p] < 0) numDirecoes = acrescentarDirecao(direcoes, numDirecoes, dx + px, dy + py);
+                if (celulas[c - p] < 0) numDirecoes = acrescentarDirecao(direcoes, numDirecoes, dx - px, dy - py);
+            }
+        }
+
+        double custoV = custos[v->indice];
+        for (int i = 0; i < numDirecoes; i++) {
+            int dx = direcoes[i][0], dy = direcoes[i][1];
+            int passos;
+            long s = saltar(grelha, c, dx, dy, alvo, &passos);
+            if (s < 0) continue;
+
+            relaxarVertice(ctx, v, grafo->porIndice[celulas[s]],
+                custoV + distanciaOctil(dx * passos, dy * passos), heuristicaOctil, destino);
+        }
+    }
+    ctx->expandidos = expandidos;
+
+    if (!encontrado) {
+        if (custo) *custo = -1.0;
+        return 0;
+    }
+    if (custo) *custo = custos[destino->indice];
+    return expandirCaminho(ctx, grafo, grelha, destino);
+}
@@ -0,0 +1,70 @@
+#ifndef FUNCOESGRELHA_H
+#define FUNCOESGRELHA_H
+
+/**
+ * @file FuncoesGrelha.h
+ * @brief Declarao das funes de grelha por frequncia e da procura Jump Point Search.
+ *
+ * As arestas criadas por `criarArestasAdjacentes` ligam cada antena s 8 vizinhas da
+ * mesma frequncia, pelo que o grafo de uma frequncia  uma grelha uniforme. A procura
+ * Jump Point Search usa essa estrutura: em vez de expandir cada clula, salta em linha
+ * reta at s clulas onde o caminho pode ter de mudar de direo (pontos de salto),
+ * e d os mesmos custos que Dijkstra sobre as arestas.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "Structs.h"
+
+ /**
+  * @brief Cria a grelha de ocupao das antenas de uma frequncia.
+  *
+  * A grelha cobre o retngulo das antenas dessa frequncia e guarda os ndices densos
+  * atuais: deve ser criada de novo depois de o grafo mudar. A grelha guarda `grafo->versao`
+  * e `caminhoJPS` recusa-a se a verso j no for a mesma.
+  *
+  * O retngulo  calculado a partir dos vrtices e no de `GR::linhas` / `GR::colunas`
+  * porque essas dimenses no limitam as coordenadas: `carregarMapaNoGrafo` repe-nas
+  * com as do ltimo mapa lido, mesmo que o grafo j tenha vrtices de mapas anteriores, e
+  * `adicionarVertice` aceita coordenadas negativas. Assim, cada antena da frequncia tem
+  * sempre uma clula, e uma frequncia que ocupa s uma parte do mapa ocupa menos memria.
+  *
+  * @param grafo Apontador para o grafo.
+  * @param frequencia Frequncia das antenas.
+  * @return Apontador para a grelha, ou NULL se no houver antenas dessa frequncia, o
+  *         retngulo tiver mais colunas, linhas ou clulas do que  possvel enderear
+  *         (`int` para as dimenses, `long` para as clulas) ou faltar memria.
+  */
+GrelhaFrequencia* criarGrelhaFrequencia(const GR* grafo, char frequencia);
+
+/**
+ * @brief Liberta a memria de uma grelha.
+ *
+ * @param grelha Apontador para a grelha.
+ */
+void libertarGrelhaFrequencia(GrelhaFrequencia* grelha);
+
+/**
+ * @brief Calcula o caminho mais curto entre duas antenas da frequncia da grelha, com
+ * Jump Point Search.
+ *
+ * O caminho fica em `ctx->caminho[0 .. n-1]`, clula a clula, da origem ao destino, e
+ * `ctx->expandidos` recebe o nmero de pontos de salto expandidos. O resultado s 
+ * igual ao de `caminhoDijkstra` se as arestas forem as de `criarArestasAdjacentes`.
+ *
+ * @param ctx Apontador para o contexto (uma thread de cada vez).
+ * @param grafo Apontador para o grafo da grelha.
+ * @param grelha Apontador para a grelha da frequncia.
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @param custo Se no for NULL, recebe o custo do caminho (-1 se no existir).
+ * @return Nmero de vrtices do caminho, 0 se o destino no for alcanvel, ou -1 se
+ *         parmetros invlidos (vrtices fora da grelha, grelha de outro grafo ou
+ *         criada antes da ltima alterao ao grafo) ou faltar memria.
+ */
+int caminhoJPS(ContextoProcura* ctx, const GR* grafo, const GrelhaFrequencia* grelha,
+    Vertice* origem, Vertice* destino, double* custo);
+
+#endif // FUNCOESGRELHA_H
@@ -0,0 +1,158 @@
+/**
+ * @file FuncoesHeap.c
+ * @brief Implementao do heap indexado 4-rio.
+ *
+ * @details
+ * As entradas guardam a chave e o desempate ao lado do ndice, pelo que subir e descer
+ * no heap s l o vetor `entradas`. O vetor `posicao` s  escrito quando uma entrada
+ * muda de lugar, e permite diminuir a chave de um vrtice sem o procurar.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <stdlib.h>
+#include "Structs.h"
+#include "FuncoesHeap.h"
+
+#define ARIDADE_HEAP 4
+
+/**
+ * @brief Indica se a entrada `a` tem prioridade sobre `b`.
+ */
+static int precede(const EntradaHeap* a, const EntradaHeap* b) {
+    return a->chave < b->chave || (a->chave == b->chave && a->desempate < b->desempate);
+}
+
+/**
+ * @brief Sobe a entrada da posio `i` at ao seu lugar.
+ */
+static void subir(HeapIndexado* h, int i) {
+    EntradaHeap e = h->entradas[i];
+    while (i > 0) {
+        int pai = (i - 1) / ARIDADE_HEAP;
+        if (!precede(&e, &h->entradas[pai])) break;
+        h->entradas[i] = h->entradas[pai];
+        h->posicao[h->entradas[i].indice] = i;
+        i = pai;
+    }
+    h->entradas[i] = e;
+    h->posicao[e.indice] = i;
+}
+
+/**
+ * @brief Desce a entrada da posio `i` at ao seu lugar.
+ */
+static void descer(HeapIndexado* h, int i) {
+    EntradaHeap e = h->entradas[i];
+    for (;;) {
+        int primeiro = i * ARIDADE_HEAP + 1;
+        if (primeiro >= h->tamanho) break;
+        int ultimo = primeiro + ARIDADE_HEAP < h->tamanho ? primeiro + ARIDADE_HEAP : h->tamanho;
+
+        int menor = primeiro;
+        for (int f = primeiro + 1; f < ultimo; f++) {
+            if (precede(&h->entradas[f], &h->entradas[menor])) menor = f;
+        }
+        if (!precede(&h->entradas[menor], &e)) break;
+        h->entradas[i] = h->entradas[menor];
+        h->posicao[h->entradas[i].indice] = i;
+        i = menor;
+    }
+    h->entradas[i] = e;
+    h->posicao[e.indice] = i;
+}
+
+/**
+ * @brief Aumenta os vetores do heap para `capacidade` posies.
+ *
+ * @param h Apontador para o heap.
+ * @param capacidade Nmero de vrtices a suportar.
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se faltar memria.
+ */
+int reservarHeap(HeapIndexado* h, int capacidade) {
+    if (!h || capacidade < 0) return -1;
+    if (capacidade <= h->capacidade) return 0;
+
+    EntradaHeap* entradas = realloc(h->entradas, (size_t)capacidade * sizeof(EntradaHeap));
+    if (!entradas) return -2;
+    h->entradas = entradas;
+    int* posicao = realloc(h->posicao, (size_t)capacidade * sizeof(int));
+    if (!posicao) return -2;
+    h->posicao = posicao;
+    h->capacidade = capacidade;
+    return 0;
+}
+
+/**
+ * @brief Esvazia o heap.
+ *
+ * @param h Apontador para o heap.
+ */
+void esvaziarHeap(HeapIndexado* h) {
+    h->tamanho = 0;
+}
+
+/**
+ * @brief Insere um vrtice no heap.
+ *
+ * @param h Apontador para o heap.
+ * @param indice ndice denso do vrtice (ainda fora do heap).
+ * @param chave Prioridade.
+ * @param desempate Desempate entre prioridades iguais.
+ */
+void inserirHeap(HeapIndexado* h, int indice, double chave, double desempate) {
+    int i = h->tamanho++;
+    h->entradas[i].chave = chave;
+    h->entradas[i].desempate = desempate;
+    h->entradas[i].indice = indice;
+    subir(h, i);
+}
+
+/**
+ * @brief Diminui a prioridade de um vrtice do heap.
+ *
+ * @param h Apontador para o heap.
+ * @param indice ndice denso do vrtice (no heap).
+ * @param chave Nova prioridade.
+ * @param desempate Novo desempate.
+ */
+void diminuirChaveHeap(HeapIndexado* h, int indice, double chave, double desempate) {
+    int i = h->posicao[indice];
+    h->entradas[i].chave = chave;
+    h->entradas[i].desempate = desempate;
+    subir(h, i);
+}
+
+/**
+ * @brief Retira o vrtice de menor prioridade, marcando a sua posio com -1.
+ *
+ * @param h Apontador para o heap (no vazio).
+ * @return ndice denso do vrtice retirado.
+ */
+int extrairMinimoHeap(HeapIndexado* h) {
+    int indice = h->entradas[0].indice;
+    h->posicao[indice] = -1;
+    h->tamanho--;
+    if (h->tamanho > 0) {
+        h->entradas[0] = h->entradas[h->tamanho];
+        descer(h, 0);
+    }
+    return indice;
+}
+
+/**
+ * @brief Liberta a memria do heap.
+ *
+ * @param h Apontador para o heap.
+ */
+void libertarHeap(HeapIndexado* h) {
+    if (!h) return;
+    free(h->entradas);
+    free(h->posicao);
+    h->entradas = NULL;
+    h->posicao = NULL;
+    h->tamanho = 0;
+    h->capacidade = 0;
+}
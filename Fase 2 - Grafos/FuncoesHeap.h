@@ -0,0 +1,70 @@
+#ifndef FUNCOESHEAP_H
+#define FUNCOESHEAP_H
+
+/**
+ * @file FuncoesHeap.h
+ * @brief Declarao das funes do heap indexado (fila de prioridade por ndice denso).
+ *
+ * O heap  4-rio: tem metade da altura de um heap binrio e os 4 filhos de cada n
+ * esto seguidos em memria, o que reduz as falhas de cache ao descer no heap.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "Structs.h"
+
+ /**
+  * @brief Garante que o heap aceita vrtices com ndice denso at `capacidade - 1`.
+  * O contedo do heap  mantido.
+  *
+  * @param h Apontador para o heap.
+  * @param capacidade Nmero de vrtices a suportar.
+  * @return 0 se sucesso, -1 se parmetros invlidos, -2 se faltar memria.
+  */
+int reservarHeap(HeapIndexado* h, int capacidade);
+
+/**
+ * @brief Esvazia o heap em tempo constante.
+ *
+ * @param h Apontador para o heap.
+ */
+void esvaziarHeap(HeapIndexado* h);
+
+/**
+ * @brief Insere um vrtice que ainda no est no heap.
+ *
+ * @param h Apontador para o heap.
+ * @param indice ndice denso do vrtice.
+ * @param chave Prioridade.
+ * @param desempate Desempate entre prioridades iguais.
+ */
+void inserirHeap(HeapIndexado* h, int indice, double chave, double desempate);
+
+/**
+ * @brief Diminui a prioridade de um vrtice que est no heap.
+ *
+ * @param h Apontador para o heap.
+ * @param indice ndice denso do vrtice.
+ * @param chave Nova prioridade (menor do que a atual).
+ * @param desempate Novo desempate.
+ */
+void diminuirChaveHeap(HeapIndexado* h, int indice, double chave, double desempate);
+
+/**
+ * @brief Retira o vrtice de menor prioridade.
+ *
+ * @param h Apontador para o heap (no vazio).
+ * @return ndice denso do vrtice retirado.
+ */
+int extrairMinimoHeap(HeapIndexado* h);
+
+/**
+ * @brief Liberta a memria do heap.
+ *
+ * @param h Apontador para o heap.
+ */
+void libertarHeap(HeapIndexado* h);
+
+#endif // FUNCOESHEAP_H
@@ -0,0 +1,430 @@
+/**
+ * @file FuncoesIndice.c
+ * @brief Implementao dos ndices auxiliares do grafo.
+ *
+ * @details
+ * O ndice de coordenadas  uma tabela de disperso com endereamento aberto e
+ * sondagem linear, onde a chave so as coordenadas (x, y) empacotadas num inteiro
+ * de 64 bits. A tabela mantm uma taxa de ocupao mxima de 50%, pelo que a
+ * procura de um vrtice pelas coordenadas tem custo constante em mdia, ao
+ * contrrio da pesquisa linear na lista de vrtices.
+ *
+ * A remoo usa deslocamento para trs (backward shift), evitando marcas de
+ * entradas apagadas e mantendo as sequncias de sondagem curtas.
+ *
+ * O ndice de IDs  uma tabela de acesso direto, indexada pelo prprio ID. Como
+ * os IDs so atribudos sequencialmente por `carregarMapaNoGrafo`, a tabela 
+ * densa e cresce por duplicao quando aparece um ID maior que a capacidade.
+ * Ocupa sizeof(Vertice*) bytes por posio at ao maior ID, pelo que `indexarId`
+ * recusa IDs que obrigariam a tabela a ter mais de IDS_POR_VERTICE_MAXIMO posies
+ * por vrtice (acima de FOLGA_IDS).
+ *
+ * O ndice denso numera os vrtices de 0 a numVertices-1 (`Vertice::indice`), para
+ * que as procuras possam guardar o seu estado em vetores fora dos vrtices. Ao remover
+ * um vrtice, o ltimo ocupa o seu lugar, pelo que a numerao fica sempre contgua.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "Structs.h"
+#include "FuncoesIndice.h"
+#include "FuncoesThreads.h"
+
+#define CAPACIDADE_MINIMA_COORD 16
+#define CAPACIDADE_MAXIMA_COORD ((size_t)1 << 30)  // maior potncia de 2 que cabe no int `capacidadeCoord`
+#define CAPACIDADE_MINIMA_ID 16
+#define CAPACIDADE_MAXIMA_ID ((size_t)INT_MAX)  // `capacidadeId`  um int
+#define FOLGA_IDS 4096          // IDs abaixo deste valor so sempre aceites
+#define IDS_POR_VERTICE_MAXIMO 64  // posies da tabela de IDs admitidas por vrtice
+#define CAPACIDADE_MINIMA_DENSO 16
+#define CAPACIDADE_MAXIMA_DENSO ((size_t)INT_MAX)  // `capacidadeDenso`  um int
+
+/**
+ * @brief Empacota as coordenadas (x, y) numa nica chave de 64 bits.
+ */
+static long long chaveCoordenadas(int x, int y) {
+    return (long long)(((unsigned long long)(unsigned int)x << 32) | (unsigned int)y);
+}
+
+/**
+ * @brief Espalha os bits da chave para distribuir bem posies vizinhas na tabela.
+ */
+static unsigned int dispersarChave(long long chave, int capacidade) {
+    unsigned long long h = (unsigned long long)chave;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return (unsigned int)(h & (unsigned long long)(capacidade - 1));
+}
+
+/**
+ * @brief Realoca a tabela de coordenadas com uma nova capacidade e reinsere as entradas.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param novaCapacidade Nova capacidade (potncia de 2).
+ * @return 0 se sucesso, -2 se falhar a alocao de memria.
+ */
+static int redimensionarIndiceCoordenadas(GR* grafo, int novaCapacidade) {
+    EntradaCoordenada* nova = calloc((size_t)novaCapacidade, sizeof(EntradaCoordenada));
+    if (!nova) return -2;
+
+    for (int i = 0; i < grafo->capacidadeCoord; i++) {
+        EntradaCoordenada* e = &grafo->indiceCoord[i];
+        if (!e->vertice) continue;
+        unsigned int pos = dispersarChave(e->chave, novaCapacidade);
+        while (nova[pos].vertice) {
+            pos = (pos + 1) & (unsigned int)(novaCapacidade - 1);
+        }
+        nova[pos] = *e;
+    }
+
+    free(grafo->indiceCoord);
+    grafo->indiceCoord = nova;
+    grafo->capacidadeCoord = novaCapacidade;
+    return 0;
+}
+
+/**
+ * @brief Garante espao no ndice de coordenadas para `numVertices` vrtices.
+ *
+ * A capacidade  escolhida de forma a manter a ocupao abaixo de 50%. A conta  feita
+ * em `size_t` e limitada a CAPACIDADE_MAXIMA_COORD, para que muitos vrtices no
+ * provoquem transbordo.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param numVertices Nmero de vrtices a suportar.
+ * @return 0 se sucesso, -1 se o grafo for invlido, -2 se forem vrtices demais ou falhar
+ *         a alocao de memria.
+ */
+int reservarIndiceCoordenadas(GR* grafo, int numVertices) {
+    if (!grafo || numVertices < 0) return -1;
+
+    size_t necessario = 2 * (size_t)numVertices;  // capacidade / 2 >= numVertices
+    if (necessario > CAPACIDADE_MAXIMA_COORD) return -2;
+
+    size_t capacidade = grafo->capacidadeCoord > 0 ? (size_t)grafo->capacidadeCoord : CAPACIDADE_MINIMA_COORD;
+    while (capacidade < necessario) {
+        capacidade *= 2;   // potncia de 2, no mximo CAPACIDADE_MAXIMA_COORD
+    }
+    if (capacidade > SIZE_MAX / sizeof(EntradaCoordenada)) return -2;
+    if (capacidade == (size_t)grafo->capacidadeCoord) return 0;
+    return redimensionarIndiceCoordenadas(grafo, (int)capacidade);
+}
+
+/**
+ * @brief Insere um vrtice no ndice de coordenadas.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se falhar a alocao de memria,
+ *         -3 se a posio j estiver ocupada por outro vrtice.
+ */
+int indexarCoordenadas(GR* grafo, Vertice* v) {
+    if (!grafo || !v) return -1;
+
+    if (reservarIndiceCoordenadas(grafo, grafo->numVertices + 1) != 0) return -2;
+
+    long long chave = chaveCoordenadas(v->x, v->y);
+    unsigned int mascara = (unsigned int)(grafo->capacidadeCoord - 1);
+    unsigned int pos = dispersarChave(chave, grafo->capacidadeCoord);
+    while (grafo->indiceCoord[pos].vertice) {
+        if (grafo->indiceCoord[pos].chave == chave) return -3;  // posio ocupada
+        pos = (pos + 1) & mascara;
+    }
+    grafo->indiceCoord[pos].chave = chave;
+    grafo->indiceCoord[pos].vertice = v;
+    return 0;
+}
+
+/**
+ * @brief Insere um vrtice no ndice de coordenadas a partir de vrias threads.
+ *
+ * Cada entrada livre  reclamada com compare-and-swap sobre o apontador do vrtice e
+ * s depois  escrita a chave, pela thread que a reclamou. As chaves das outras entradas
+ * nunca so lidas, pelo que a funo no deteta posies repetidas: quem chama garante
+ * que os vrtices tm coordenadas distintas entre si e das j indexadas.
+ *
+ * @param grafo Apontador para o grafo (com capacidade j reservada).
+ * @param v Apontador para o vrtice.
+ * @return 0 se sucesso, -1 se parmetros invlidos.
+ */
+int indexarCoordenadasConcorrente(GR* grafo, Vertice* v) {
+    if (!grafo || !v || grafo->capacidadeCoord == 0) return -1;
+
+    long long chave = chaveCoordenadas(v->x, v->y);
+    unsigned int mascara = (unsigned int)(grafo->capacidadeCoord - 1);
+    unsigned int pos = dispersarChave(chave, grafo->capacidadeCoord);
+    while (!compararETrocarApontador((void* volatile*)&grafo->indiceCoord[pos].vertice, NULL, v)) {
+        pos = (pos + 1) & mascara;
+    }
+    grafo->indiceCoord[pos].chave = chave;
+    return 0;
+}
+
+/**
+ * @brief Remove um vrtice do ndice de coordenadas.
+ *
+ * Depois de libertar a entrada, as entradas seguintes da mesma sequncia de
+ * sondagem so deslocadas para trs, para que continuem a ser encontradas.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return 0 se sucesso, -1 se parmetros invlidos ou o vrtice no estiver indexado.
+ */
+int desindexarCoordenadas(GR* grafo, Vertice* v) {
+    if (!grafo || !v || grafo->capacidadeCoord == 0) return -1;
+
+    long long chave = chaveCoordenadas(v->x, v->y);
+    unsigned int mascara = (unsigned int)(grafo->capacidadeCoord - 1);
+    unsigned int pos = dispersarChave(chave, grafo->capacidadeCoord);
+    while (grafo->indiceCoord[pos].vertice != v) {
+        if (!grafo->indiceCoord[pos].vertice) return -1;  // no indexado
+        pos = (pos + 1) & mascara;
+    }
+
+    // deslocamento para trs das entradas que dependiam desta posio
+    unsigned int livre = pos;
+    unsigned int seguinte = (pos + 1) & mascara;
+    while (grafo->indiceCoord[seguinte].vertice) {
+        unsigned int ideal = dispersarChave(grafo->indiceCoord[seguinte].chave, grafo->capacidadeCoord);
+        // a entrada pode ocupar a posio livre se esta estiver entre a ideal e a atual
+        if (((seguinte - ideal) & mascara) >= ((seguinte - livre) & mascara)) {
+            grafo->indiceCoord[livre] = grafo->indiceCoord[seguinte];
+            livre = seguinte;
+        }
+        seguinte = (seguinte + 1) & mascara;
+    }
+    grafo->indiceCoord[livre].vertice = NULL;
+    grafo->indiceCoord[livre].chave = 0;
+    return 0;
+}
+
+/**
+ * @brief Procura no ndice o vrtice que ocupa as coordenadas (x, y).
+ *
+ * @param grafo Apontador para o grafo.
+ * @param x Coordenada x.
+ * @param y Coordenada y.
+ * @return Apontador para o vrtice ou NULL se a posio estiver vazia.
+ */
+Vertice* consultarCoordenadas(const GR* grafo, int x, int y) {
+    if (!grafo || grafo->capacidadeCoord == 0) return NULL;
+
+    long long chave = chaveCoordenadas(x, y);
+    unsigned int mascara = (unsigned int)(grafo->capacidadeCoord - 1);
+    unsigned int pos = dispersarChave(chave, grafo->capacidadeCoord);
+    while (grafo->indiceCoord[pos].vertice) {
+        if (grafo->indiceCoord[pos].chave == chave) return grafo->indiceCoord[pos].vertice;
+        pos = (pos + 1) & mascara;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Garante que a tabela de IDs tem posies para os IDs 0..maxId.
+ *
+ * A capacidade cresce por duplicao e as novas posies ficam a NULL. A conta  feita
+ * em `size_t` e limitada a CAPACIDADE_MAXIMA_ID, para que IDs muito grandes no
+ * provoquem transbordo.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param maxId Maior ID a suportar.
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se o ID for demasiado grande ou
+ *         falhar a alocao de memria.
+ */
+int reservarIndiceIds(GR* grafo, int maxId) {
+    if (!grafo || maxId < 0) return -1;
+    if (maxId < grafo->capacidadeId) return 0;
+
+    size_t necessario = (size_t)maxId + 1;
+    if (necessario > CAPACIDADE_MAXIMA_ID || necessario > SIZE_MAX / sizeof(Vertice*)) return -2;
+
+    size_t capacidade = grafo->capacidadeId > 0 ? (size_t)grafo->capacidadeId : CAPACIDADE_MINIMA_ID;
+    while (capacidade < necessario) {
+        capacidade *= 2;
+    }
+    if (capacidade > CAPACIDADE_MAXIMA_ID || capacidade > SIZE_MAX / sizeof(Vertice*)) {
+        capacidade = necessario;  // a duplicao passaria do limite: s o necessrio
+    }
+
+    Vertice** nova = realloc(grafo->indiceId, capacidade * sizeof(Vertice*));
+    if (!nova) return -2;
+    for (size_t i = (size_t)grafo->capacidadeId; i < capacidade; i++) {
+        nova[i] = NULL;
+    }
+    grafo->indiceId = nova;
+    grafo->capacidadeId = (int)capacidade;
+    return 0;
+}
+
+/**
+ * @brief Indica se a tabela de IDs pode crescer at `id` sem ficar demasiado esparsa.
+ *
+ * Um nico vrtice com um ID perto de INT_MAX obrigaria a tabela a ter cerca de 16 GB
+ * de apontadores. Acima de FOLGA_IDS, a tabela s cresce se tiver no mximo
+ * IDS_POR_VERTICE_MAXIMO posies por vrtice (contando com o que vai ser inserido).
+ *
+ * @param grafo Apontador para o grafo.
+ * @param id ID a suportar.
+ * @return 1 se o crescimento for aceitvel, 0 caso contrrio.
+ */
+static int idDentroDoLimite(const GR* grafo, int id) {
+    size_t necessario = (size_t)id + 1;
+    if (necessario <= FOLGA_IDS) return 1;
+    return necessario / IDS_POR_VERTICE_MAXIMO <= (size_t)grafo->numVertices + 1;
+}
+
+/**
+ * @brief Insere um vrtice na tabela de IDs.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return 0 se sucesso, -1 se parmetros invlidos (ID negativo), -2 se falhar a
+ *         alocao de memria, -4 se o ID j estiver em uso, -6 se o ID for demasiado
+ *         grande para o nmero de vrtices (ver `idDentroDoLimite`).
+ */
+int indexarId(GR* grafo, Vertice* v) {
+    if (!grafo || !v || v->id < 0) return -1;
+    if (v->id >= grafo->capacidadeId && !idDentroDoLimite(grafo, v->id)) return -6;
+    if (reservarIndiceIds(grafo, v->id) != 0) return -2;
+    if (grafo->indiceId[v->id]) return -4;  // ID repetido
+
+    grafo->indiceId[v->id] = v;
+    return 0;
+}
+
+/**
+ * @brief Remove um vrtice da tabela de IDs.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return 0 se sucesso, -1 se parmetros invlidos ou o vrtice no estiver indexado.
+ */
+int desindexarId(GR* grafo, Vertice* v) {
+    if (!grafo || !v || v->id < 0 || v->id >= grafo->capacidadeId) return -1;
+    if (grafo->indiceId[v->id] != v) return -1;
+
+    grafo->indiceId[v->id] = NULL;
+    return 0;
+}
+
+/**
+ * @brief Devolve o vrtice com um dado ID, em tempo constante.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param id ID a procurar.
+ * @return Apontador para o vrtice ou NULL se no existir.
+ */
+Vertice* consultarId(const GR* grafo, int id) {
+    if (!grafo || id < 0 || id >= grafo->capacidadeId) return NULL;
+    return grafo->indiceId[id];
+}
+
+/**
+ * @brief Garante que o ndice denso tem posies para `numVertices` vrtices.
+ *
+ * A capacidade cresce por duplicao, com a conta feita em `size_t` e limitada a
+ * CAPACIDADE_MAXIMA_DENSO.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param numVertices Nmero de vrtices a suportar.
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se falhar a alocao de memria.
+ */
+int reservarIndiceDenso(GR* grafo, int numVertices) {
+    if (!grafo || numVertices < 0) return -1;
+    if (numVertices <= grafo->capacidadeDenso) return 0;
+
+    size_t necessario = (size_t)numVertices;  // nunca passa de INT_MAX
+    if (necessario > SIZE_MAX / sizeof(Vertice*)) return -2;
+
+    size_t capacidade = grafo->capacidadeDenso > 0 ? (size_t)grafo->capacidadeDenso : CAPACIDADE_MINIMA_DENSO;
+    while (capacidade < necessario) {
+        capacidade *= 2;
+    }
+    if (capacidade > CAPACIDADE_MAXIMA_DENSO || capacidade > SIZE_MAX / sizeof(Vertice*)) {
+        capacidade = necessario;  // a duplicao passaria do limite: s o necessrio
+    }
+
+    Vertice** nova = realloc(grafo->porIndice, capacidade * sizeof(Vertice*));
+    if (!nova) return -2;
+    grafo->porIndice = nova;
+    grafo->capacidadeDenso = (int)capacidade;
+    return 0;
+}
+
+/**
+ * @brief D ao vrtice o prximo ndice denso livre (`grafo->numVertices`).
+ *
+ * Deve ser chamada antes de incrementar `grafo->numVertices`.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se falhar a alocao de memria.
+ */
+int indexarDenso(GR* grafo, Vertice* v) {
+    if (!grafo || !v) return -1;
+    if (reservarIndiceDenso(grafo, grafo->numVertices + 1) != 0) return -2;
+
+    v->indice = grafo->numVertices;
+    grafo->porIndice[v->indice] = v;
+    grafo->versao++;
+    return 0;
+}
+
+/**
+ * @brief Retira um vrtice do ndice denso, passando o ltimo vrtice para o seu lugar.
+ *
+ * Deve ser chamada antes de decrementar `grafo->numVertices`.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return 0 se sucesso, -1 se parmetros invlidos ou o vrtice no estiver indexado.
+ */
+int desindexarDenso(GR* grafo, Vertice* v) {
+    if (!grafo || !v || v->indice < 0 || v->indice >= grafo->numVertices) return -1;
+    if (grafo->porIndice[v->indice] != v) return -1;
+
+    Vertice* ultimo = grafo->porIndice[grafo->numVertices - 1];
+    grafo->porIndice[v->indice] = ultimo;
+    ultimo->indice = v->indice;
+    v->indice = -1;
+    grafo->versao++;
+    return 0;
+}
+
+/**
+ * @brief Devolve o vrtice com um dado ndice denso.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param indice ndice denso (0 .. numVertices-1).
+ * @return Apontador para o vrtice ou NULL se o ndice estiver fora dos limites.
+ */
+Vertice* consultarIndice(const GR* grafo, int indice) {
+    if (!grafo || indice < 0 || indice >= grafo->numVertices) return NULL;
+    return grafo->porIndice[indice];
+}
+
+/**
+ * @brief Liberta a memria dos ndices do grafo, deixando-os vazios.
+ *
+ * @param grafo Apontador para o grafo.
+ */
+void libertarIndices(GR* grafo) {
+    if (!grafo) return;
+    free(grafo->indiceCoord);
+    grafo->indiceCoord = NULL;
+    grafo->capacidadeCoord = 0;
+    free(grafo->indiceId);
+    grafo->indiceId = NULL;
+    grafo->capacidadeId = 0;
+    free(grafo->porIndice);
+    grafo->porIndice = NULL;
+    grafo->capacidadeDenso = 0;
+}
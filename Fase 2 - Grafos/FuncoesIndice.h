@@ -0,0 +1,155 @@
+#ifndef FUNCOESINDICE_H
+#define FUNCOESINDICE_H
+
+/**
+ * @file FuncoesIndice.h
+ * @brief Declarao das funes que mantm os ndices auxiliares do grafo.
+ *
+ * Os ndices permitem encontrar vrtices sem percorrer a lista ligada do grafo.
+ * So mantidos atualizados por `adicionarVertice` e `removerVerticePorId`.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "Structs.h"
+
+ /**
+  * @brief Garante que o ndice de coordenadas tem espao para um dado nmero de vrtices.
+  *
+  * @param grafo Apontador para o grafo.
+  * @param numVertices Nmero de vrtices que o ndice deve suportar sem crescer.
+  * @return 0 se sucesso, -1 se o grafo for invlido, -2 se forem vrtices demais (mais de
+  *         2^29, para manter a ocupao abaixo de 50%) ou falhar a alocao de memria.
+  */
+int reservarIndiceCoordenadas(GR* grafo, int numVertices);
+
+/**
+ * @brief Regista um vrtice no ndice de coordenadas do grafo.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice a indexar.
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se falhar a alocao de memria,
+ *         -3 se j existir um vrtice nas mesmas coordenadas.
+ */
+int indexarCoordenadas(GR* grafo, Vertice* v);
+
+/**
+ * @brief Regista um vrtice no ndice de coordenadas, podendo ser chamada por vrias threads ao mesmo tempo.
+ *
+ * O ndice tem de ter sido reservado antes (`reservarIndiceCoordenadas`) e os vrtices
+ * tm de ter coordenadas distintas entre si e das dos vrtices j indexados.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice a indexar.
+ * @return 0 se sucesso, -1 se parmetros invlidos.
+ */
+int indexarCoordenadasConcorrente(GR* grafo, Vertice* v);
+
+/**
+ * @brief Retira um vrtice do ndice de coordenadas do grafo.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice a retirar.
+ * @return 0 se sucesso, -1 se parmetros invlidos ou o vrtice no estiver indexado.
+ */
+int desindexarCoordenadas(GR* grafo, Vertice* v);
+
+/**
+ * @brief Consulta o ndice de coordenadas do grafo.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param x Coordenada x a procurar.
+ * @param y Coordenada y a procurar.
+ * @return Apontador para o vrtice nessas coordenadas ou NULL se no existir.
+ */
+Vertice* consultarCoordenadas(const GR* grafo, int x, int y);
+
+/**
+ * @brief Garante que o ndice de IDs suporta IDs at `maxId` sem crescer.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param maxId Maior ID que o ndice deve suportar.
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se o ID for demasiado grande
+ *         (a partir de INT_MAX) ou falhar a alocao de memria.
+ *
+ * @note No limita a disperso: a tabela ocupa sizeof(Vertice*) bytes por ID at `maxId`.
+ *       S deve ser chamada com IDs j validados (mapas carregados, snapshots CSR).
+ */
+int reservarIndiceIds(GR* grafo, int maxId);
+
+/**
+ * @brief Regista um vrtice no ndice de IDs do grafo.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice a indexar (ID no negativo).
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se falhar a alocao de memria,
+ *         -4 se o ID j estiver em uso, -6 se a tabela de IDs ficasse com mais de 64
+ *         posies por vrtice (IDs at 4095 so sempre aceites).
+ */
+int indexarId(GR* grafo, Vertice* v);
+
+/**
+ * @brief Retira um vrtice do ndice de IDs do grafo.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice a retirar.
+ * @return 0 se sucesso, -1 se parmetros invlidos ou o vrtice no estiver indexado.
+ */
+int desindexarId(GR* grafo, Vertice* v);
+
+/**
+ * @brief Consulta o ndice de IDs do grafo.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param id ID a procurar.
+ * @return Apontador para o vrtice com esse ID ou NULL se no existir.
+ */
+Vertice* consultarId(const GR* grafo, int id);
+
+/**
+ * @brief Garante que o ndice denso suporta `numVertices` vrtices sem crescer.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param numVertices Nmero de vrtices a suportar.
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se falhar a alocao de memria.
+ */
+int reservarIndiceDenso(GR* grafo, int numVertices);
+
+/**
+ * @brief Atribui ao vrtice o ndice denso `grafo->numVertices` (chamar antes de o incrementar).
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se falhar a alocao de memria.
+ */
+int indexarDenso(GR* grafo, Vertice* v);
+
+/**
+ * @brief Retira o vrtice do ndice denso; o ltimo vrtice fica com o seu ndice
+ * (chamar antes de decrementar `grafo->numVertices`).
+ *
+ * @param grafo Apontador para o grafo.
+ * @param v Apontador para o vrtice.
+ * @return 0 se sucesso, -1 se parmetros invlidos ou o vrtice no estiver indexado.
+ */
+int desindexarDenso(GR* grafo, Vertice* v);
+
+/**
+ * @brief Consulta o ndice denso do grafo.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param indice ndice denso.
+ * @return Apontador para o vrtice com esse ndice ou NULL se no existir.
+ */
+Vertice* consultarIndice(const GR* grafo, int indice);
+
+/**
+ * @brief Liberta a memria de todos os ndices do grafo.
+ *
+ * @param grafo Apontador para o grafo.
+ */
+void libertarIndices(GR* grafo);
+
+#endif // FUNCOESINDICE_H
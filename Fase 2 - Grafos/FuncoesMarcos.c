@@ -0,0 +1,435 @@
+/**
+ * @file FuncoesMarcos.c
+ * @brief Implementao do pr-processamento ALT e da sua gravao em ficheiro.
+ *
+ * @details
+ * Numa consulta s os `MARCOS_ATIVOS` marcos com o melhor minorante na origem entram
+ * na heurstica: os restantes raramente ganham ao longo do caminho e tornariam cada
+ * avaliao mais lenta. Um marco que alcana s um dos extremos da consulta prova que
+ * esto em componentes diferentes, e a consulta termina sem procura.
+ *
+ * Formato do ficheiro: cabealho `CabecalhoMarcos`, o ID de cada marco (-1 se no foi
+ * escolhido) e, para cada vrtice, o seu ID seguido das `numMarcos` distncias. O
+ * cabealho guarda tambm o nmero de arestas e uma impresso digital das arestas (IDs
+ * das pontas e peso), que no depende da ordem dos vrtices nem das listas de adjacncia.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <float.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Structs.h"
+#include "FuncoesMarcos.h"
+#include "FuncoesCaminhoMinimo.h"
+#include "FuncoesComponentes.h"
+#include "FuncoesContexto.h"
+#include "FuncoesVertice.h"
+
+#define MARCOS_ATIVOS 8
+#define ASSINATURA_MARCOS "EDAMARCO"   // 8 caracteres, sem o '\0'
+#define VERSAO_MARCOS 2u
+#define MARCA_ORDEM_BYTES 0x01020304u
+
+/**
+ * @brief Cabealho do ficheiro de marcos.
+ */
+typedef struct CabecalhoMarcos {
+    char assinatura[8];       /**< ASSINATURA_MARCOS */
+    unsigned int versao;      /**< VERSAO_MARCOS */
+    unsigned int ordemBytes;  /**< MARCA_ORDEM_BYTES, tal como escrita pela mquina de origem */
+    int numMarcos;            /**< Nmero de marcos */
+    int numVertices;          /**< Nmero de vrtices */
+    long long numArestas;     /**< Nmero de arestas */
+    uint64_t impressaoArestas; /**< Impresso digital das arestas (ver impressaoArestas) */
+} CabecalhoMarcos;
+
+/**
+ * @brief Marcos escolhidos para uma consulta e as suas distncias ao destino.
+ */
+typedef struct HeuristicaMarcos {
+    const double* distancias;           /**< Distncias de todos os vrtices */
+    int numMarcos;                      /**< Colunas de `distancias` */
+    int numAtivos;                      /**< Marcos usados na consulta */
+    int ativos[MARCOS_ATIVOS];          /**< Coluna de cada marco usado */
+    double aoDestino[MARCOS_ATIVOS];    /**< Distncia de cada marco usado ao destino */
+} HeuristicaMarcos;
+
+/**
+ * @brief Reserva os marcos do grafo no seu estado atual, todos por escolher.
+ */
+static Marcos* reservarMarcos(const GR* grafo, int numMarcos) {
+    int numVertices = grafo->numVertices;
+    Marcos* m = malloc(sizeof(Marcos));
+    if (!m) return NULL;
+    m->numMarcos = numMarcos;
+    m->numVertices = numVertices;
+    m->grafo = grafo;
+    m->versaoGrafo = grafo->versao;
+    m->indices = malloc((size_t)numMarcos * sizeof(int));
+    m->distancias = malloc((size_t)numMarcos * (size_t)(numVertices > 0 ? numVertices : 1) * sizeof(double));
+    if (!m->indices || !m->distancias) {
+        libertarMarcos(m);
+        return NULL;
+    }
+    for (int k = 0; k < numMarcos; k++) {
+        m->indices[k] = -1;
+    }
+    return m;
+}
+
+/**
+ * @brief Indica se os marcos foram calculados para o grafo e este no mudou desde ento.
+ */
+static int marcosAtualizados(const Marcos* marcos, const GR* grafo) {
+    return marcos->grafo == grafo && marcos->versaoGrafo == grafo->versao &&
+        marcos->numVertices == grafo->numVertices;
+}
+
+/**
+ * @brief Escolhe o prximo marco.
+ *
+ * Prefere um vrtice de uma componente ainda sem marco (a maior, se tiver pelo menos
+ * `limiar` vrtices), afastado dela por um Dijkstra; seno, o vrtice coberto mais
+ * afastado dos marcos j escolhidos.
+ *
+ * @return ndice denso do marco, -1 se no houver mais nenhum til, -2 se faltar memria.
+ */
+static int escolherMarco(GR* grafo, ContextoProcura* ctx, const double* menorDistancia, int limiar) {
+    int melhorNovo = -1, maiorComponente = 0;
+    int melhorCoberto = -1;
+    double maiorDistancia = 0.0;
+
+    for (int i = 0; i < grafo->numVertices; i++) {
+        if (menorDistancia[i] < 0) {
+            int tamanho = tamanhoComponente(grafo, grafo->porIndice[i]);
+            if (tamanho >= limiar && tamanho > maiorComponente) {
+                maiorComponente = tamanho;
+                melhorNovo = i;
+            }
+        }
+        else if (menorDistancia[i] > maiorDistancia) {
+            maiorDistancia = menorDistancia[i];
+            melhorCoberto = i;
+        }
+    }
+    if (melhorNovo < 0) return melhorCoberto;
+
+    // o vrtice mais afastado de um vrtice qualquer fica na periferia da componente
+    if (dijkstra(ctx, grafo, grafo->porIndice[melhorNovo]) < 0) return -2;
+    int maisAfastado = melhorNovo;
+    double distancia = 0.0;
+    for (int i = 0; i < grafo->numVertices; i++) {
+        double c = custoProcura(ctx, grafo->porIndice[i]);
+        if (c > distancia) {
+            distancia = c;
+            maisAfastado = i;
+        }
+    }
+    return maisAfastado;
+}
+
+/**
+ * @brief Escolhe os marcos e calcula as distncias.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param numMarcos Nmero de marcos pretendido.
+ * @return Apontador para os marcos, ou NULL em caso de erro.
+ */
+Marcos* criarMarcos(GR* grafo, int numMarcos) {
+    if (!grafo || numMarcos <= 0) return NULL;
+    int n = grafo->numVertices;
+
+    Marcos* m = reservarMarcos(grafo, numMarcos);
+    ContextoProcura* ctx = criarContextoProcura(grafo);
+    double* menorDistancia = malloc((size_t)(n > 0 ? n : 1) * sizeof(double));
+    int* tamanhos = NULL;
+    int numComponentes = 0;
+    if (m && ctx && menorDistancia) tamanhos = tamanhosComponentes(grafo, &numComponentes);
+    if (!m || !ctx || !menorDistancia || (n > 0 && !tamanhos)) {
+        libertarMarcos(m);
+        libertarContextoProcura(ctx);
+        free(menorDistancia);
+        free(tamanhos);
+        return NULL;
+    }
+
+    int maior = 0;
+    for (int c = 0; c < numComponentes; c++) {
+        if (tamanhos[c] > maior) maior = tamanhos[c];
+    }
+    free(tamanhos);
+    int limiar = maior / numMarcos > 2 ? maior / numMarcos : 2;  // uma antena isolada no precisa de marco
+
+    for (int i = 0; i < n; i++) {
+        menorDistancia[i] = -1.0;
+        for (int k = 0; k < numMarcos; k++) {
+            m->distancias[(size_t)i * numMarcos + k] = -1.0;
+        }
+    }
+
+    for (int k = 0; k < numMarcos; k++) {
+        int marco = escolherMarco(grafo, ctx, menorDistancia, limiar);
+        if (marco == -1) break;
+        if (marco < 0 || dijkstra(ctx, grafo, grafo->porIndice[marco]) < 0) {
+            libertarMarcos(m);
+            m = NULL;
+            break;
+        }
+        m->indices[k] = marco;
+        for (int i = 0; i < n; i++) {
+            double d = custoProcura(ctx, grafo->porIndice[i]);
+            m->distancias[(size_t)i * numMarcos + k] = d;
+            if (d >= 0 && (menorDistancia[i] < 0 || d < menorDistancia[i])) menorDistancia[i] = d;
+        }
+    }
+
+    libertarContextoProcura(ctx);
+    free(menorDistancia);
+    return m;
+}
+
+/**
+ * @brief Liberta a memria dos marcos.
+ *
+ * @param marcos Apontador para os marcos.
+ */
+void libertarMarcos(Marcos* marcos) {
+    if (!marcos) return;
+    free(marcos->indices);
+    free(marcos->distancias);
+    free(marcos);
+}
+
+/**
+ * @brief Heurstica ALT: o maior minorante |d(L,t) - d(L,v)| dos marcos ativos.
+ */
+static double heuristicaMarcos(const Vertice* v, const void* dados) {
+    const HeuristicaMarcos* h = dados;
+    const double* linha = h->distancias + (size_t)v->indice * h->numMarcos;
+    double melhor = 0.0;
+    for (int i = 0; i < h->numAtivos; i++) {
+        double d = h->aoDestino[i] - linha[h->ativos[i]];
+        if (d < 0) d = -d;
+        if (d > melhor) melhor = d;
+    }
+    return melhor;
+}
+
+/**
+ * @brief A* com a heurstica ALT entre dois vrtices.
+ *
+ * @param ctx Apontador para o contexto.
+ * @param grafo Apontador para o grafo.
+ * @param marcos Apontador para os marcos do grafo.
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @param custo Recebe o custo do caminho (-1 se no existir), se no for NULL.
+ * @return Nmero de vrtices do caminho, 0 se no existir, -1 em caso de erro.
+ */
+int caminhoALT(ContextoProcura* ctx, const GR* grafo, const Marcos* marcos,
+    Vertice* origem, Vertice* destino, double* custo) {
+    if (!ctx || !grafo || !marcos || !origem || !destino) return -1;
+    if (!marcosAtualizados(marcos, grafo) || origem->indice < 0 || destino->indice < 0) return -1;
+
+    HeuristicaMarcos h;
+    h.distancias = marcos->distancias;
+    h.numMarcos = marcos->numMarcos;
+    h.numAtivos = 0;
+
+    const double* linhaOrigem = marcos->distancias + (size_t)origem->indice * marcos->numMarcos;
+    const double* linhaDestino = marcos->distancias + (size_t)destino->indice * marcos->numMarcos;
+    double minorante[MARCOS_ATIVOS];
+
+    for (int k = 0; k < marcos->numMarcos; k++) {
+        double o = linhaOrigem[k], t = linhaDestino[k];
+        if ((o < 0) != (t < 0)) {  // o marco s alcana um dos dois: no h caminho
+            ctx->expandidos = 0;
+            if (custo) *custo = -1.0;
+            return 0;
+        }
+        if (o < 0) continue;
+
+        // insero ordenada nos MARCOS_ATIVOS melhores minorantes na origem
+        double valor = o > t ? o - t : t - o;
+        int pos = h.numAtivos < MARCOS_ATIVOS ? h.numAtivos++ : MARCOS_ATIVOS;
+        while (pos > 0 && minorante[pos - 1] < valor) {
+            if (pos < MARCOS_ATIVOS) {
+                minorante[pos] = minorante[pos - 1];
+                h.ativos[pos] = h.ativos[pos - 1];
+                h.aoDestino[pos] = h.aoDestino[pos - 1];
+            }
+            pos--;
+        }
+        if (pos < MARCOS_ATIVOS) {
+            minorante[pos] = valor;
+            h.ativos[pos] = k;
+            h.aoDestino[pos] = t;
+        }
+    }
+
+    return caminhoHeuristica(ctx, grafo, origem, destino, heuristicaMarcos, &h, custo);
+}
+
+/**
+ * @brief Mistura os bits de um valor de 64 bits (finalizador do SplitMix64).
+ */
+static uint64_t misturar(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Impresso digital das arestas do grafo: a soma de uma mistura de (origem, destino,
+ * peso) de cada aresta, com os vrtices pelo ID. Como a soma  comutativa, no depende da
+ * ordem dos vrtices nem da ordem das arestas em cada lista.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param numArestas Recebe o nmero de arestas.
+ * @return A impresso digital.
+ */
+static uint64_t impressaoArestas(const GR* grafo, long long* numArestas) {
+    uint64_t soma = 0;
+    long long n = 0;
+    for (int i = 0; i < grafo->numVertices; i++) {
+        const Vertice* v = grafo->porIndice[i];
+        for (const Aresta* a = v->adj; a != NULL; a = a->next) {
+            uint32_t bitsPeso;
+            memcpy(&bitsPeso, &a->peso, sizeof(bitsPeso));
+            uint64_t pontas = ((uint64_t)(uint32_t)v->id << 32) | (uint32_t)a->destino->id;
+            soma += misturar(misturar(pontas) ^ bitsPeso);
+            n++;
+        }
+    }
+    *numArestas = n;
+    return soma;
+}
+
+/**
+ * @brief Grava os marcos num ficheiro binrio.
+ *
+ * @param marcos Apontador para os marcos.
+ * @param grafo Apontador para o grafo dos marcos.
+ * @param nomeFicheiro Nome do ficheiro a criar.
+ * @return 0 se sucesso, -1 se parmetros invlidos ou os marcos estiverem desatualizados,
+ *         -2 se no for possvel escrever o ficheiro.
+ */
+int guardarMarcos(const Marcos* marcos, const GR* grafo, const char* nomeFicheiro) {
+    if (!marcos || !grafo || !nomeFicheiro || !marcosAtualizados(marcos, grafo)) return -1;
+
+    CabecalhoMarcos c;
+    memset(&c, 0, sizeof(c));
+    memcpy(c.assinatura, ASSINATURA_MARCOS, sizeof(c.assinatura));
+    c.versao = VERSAO_MARCOS;
+    c.ordemBytes = MARCA_ORDEM_BYTES;
+    c.numMarcos = marcos->numMarcos;
+    c.numVertices = marcos->numVertices;
+    c.impressaoArestas = impressaoArestas(grafo, &c.numArestas);
+
+    FILE* f = fopen(nomeFicheiro, "wb");
+    if (!f) {
+        perror("Erro ao criar ficheiro");
+        return -2;
+    }
+    int ok = fwrite(&c, sizeof(c), 1, f) == 1;
+    for (int k = 0; ok && k < marcos->numMarcos; k++) {
+        int id = marcos->indices[k] >= 0 ? grafo->porIndice[marcos->indices[k]]->id : -1;
+        ok = fwrite(&id, sizeof(int), 1, f) == 1;
+    }
+    for (int i = 0; ok && i < marcos->numVertices; i++) {
+        ok = fwrite(&grafo->porIndice[i]->id, sizeof(int), 1, f) == 1 &&
+            fwrite(marcos->distancias + (size_t)i * marcos->numMarcos, sizeof(double),
+                (size_t)marcos->numMarcos, f) == (size_t)marcos->numMarcos;
+    }
+    if (fclose(f) != 0) ok = 0;
+    if (!ok) {
+        remove(nomeFicheiro);  // no deixar um ficheiro incompleto
+        return -2;
+    }
+    return 0;
+}
+
+/**
+ * @brief L o ID de um vrtice do ficheiro e devolve o seu ndice denso no grafo.
+ *
+ * @return ndice denso, -1 se o ID for -1, -2 se o ID no existir ou a leitura falhar.
+ */
+static int lerIndicePorId(FILE* f, GR* grafo) {
+    int id;
+    if (fread(&id, sizeof(int), 1, f) != 1) return -2;
+    if (id == -1) return -1;
+    Vertice* v = procurarVerticePorId(grafo, id);
+    return v ? v->indice : -2;
+}
+
+/**
+ * @brief Verifica as distncias lidas de um vrtice: finitas e no negativas, ou -1 (inalcanvel).
+ *
+ * @return 1 se todas forem vlidas, 0 caso contrrio.
+ */
+static int distanciasValidas(const double* d, int numMarcos) {
+    for (int k = 0; k < numMarcos; k++) {
+        if (d[k] == -1.0) continue;
+        if (!(d[k] >= 0.0 && d[k] <= DBL_MAX)) return 0;  // tambm rejeita NaN e infinito
+    }
+    return 1;
+}
+
+/**
+ * @brief Carrega os marcos de um ficheiro, associando as distncias aos vrtices pelo ID.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param nomeFicheiro Nome do ficheiro.
+ * @return Apontador para os marcos, ou NULL em caso de erro.
+ */
+Marcos* carregarMarcos(GR* grafo, const char* nomeFicheiro) {
+    if (!grafo || !nomeFicheiro) return NULL;
+
+    FILE* f = fopen(nomeFicheiro, "rb");
+    if (!f) return NULL;
+
+    // as distncias s servem se as arestas forem as mesmas: com outras, a heurstica pode
+    // deixar de ser admissvel e caminhoALT devolveria caminhos que no so os mais curtos
+    long long numArestas;
+    uint64_t impressao = impressaoArestas(grafo, &numArestas);
+
+    CabecalhoMarcos c;
+    if (fread(&c, sizeof(c), 1, f) != 1 ||
+        memcmp(c.assinatura, ASSINATURA_MARCOS, sizeof(c.assinatura)) != 0 ||
+        c.versao != VERSAO_MARCOS || c.ordemBytes != MARCA_ORDEM_BYTES ||
+        c.numMarcos <= 0 || c.numVertices != grafo->numVertices ||
+        c.numArestas != numArestas || c.impressaoArestas != impressao) {
+        fclose(f);
+        return NULL;
+    }
+
+    Marcos* m = reservarMarcos(grafo, c.numMarcos);
+    char* lido = calloc((size_t)(c.numVertices > 0 ? c.numVertices : 1), sizeof(char));
+    int ok = m != NULL && lido != NULL;
+    for (int k = 0; ok && k < c.numMarcos; k++) {
+        m->indices[k] = lerIndicePorId(f, grafo);
+        ok = m->indices[k] != -2;
+    }
+    for (int i = 0; ok && i < c.numVertices; i++) {
+        int indice = lerIndicePorId(f, grafo);
+        ok = indice >= 0 && !lido[indice] &&  // cada vrtice uma nica vez
+            fread(m->distancias + (size_t)indice * c.numMarcos, sizeof(double),
+                (size_t)c.numMarcos, f) == (size_t)c.numMarcos &&
+            distanciasValidas(m->distancias + (size_t)indice * c.numMarcos, c.numMarcos);
+        if (ok) lido[indice] = 1;
+    }
+    fclose(f);
+    free(lido);
+    if (!ok) {
+        libertarMarcos(m);
+        return NULL;
+    }
+    return m;
+}
@@ -0,0 +1,88 @@
+#ifndef FUNCOESMARCOS_H
+#define FUNCOESMARCOS_H
+
+/**
+ * @file FuncoesMarcos.h
+ * @brief Declarao das funes de pr-processamento ALT (A*, marcos e desigualdade triangular).
+ *
+ * Para um grafo que no muda e recebe muitas consultas de caminho, calculam-se uma vez
+ * as distncias de todos os vrtices a K marcos. Numa consulta, |d(L,t) - d(L,v)|  um
+ * minorante da distncia de v ao destino t, e o maior destes valores guia o A*.
+ * As arestas devem ser simtricas (o mesmo peso nos dois sentidos), como as criadas
+ * por `criarArestasAdjacentes`.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "Structs.h"
+
+ /**
+  * @brief Escolhe os marcos e calcula as distncias de todos os vrtices a cada um.
+  *
+  * Os marcos so escolhidos pelo vrtice mais afastado dos marcos j escolhidos; as
+  * componentes ainda sem marco contam como infinitamente afastadas, desde que tenham
+  * pelo menos 1/K do tamanho da maior componente. Custa um Dijkstra por marco.
+  *
+  * @param grafo Apontador para o grafo.
+  * @param numMarcos Nmero de marcos pretendido (K).
+  * @return Apontador para os marcos, ou NULL se parmetros invlidos ou faltar memria.
+  */
+Marcos* criarMarcos(GR* grafo, int numMarcos);
+
+/**
+ * @brief Liberta a memria dos marcos.
+ *
+ * @param marcos Apontador para os marcos.
+ */
+void libertarMarcos(Marcos* marcos);
+
+/**
+ * @brief Calcula o caminho mais curto entre dois vrtices com A* e a heurstica ALT.
+ *
+ * Os marcos tm de ter sido calculados ou carregados para este grafo, sem alteraes
+ * desde ento (`GR::versao`); caso contrrio a funo devolve -1.
+ *
+ * @param ctx Apontador para o contexto (uma thread de cada vez; os marcos podem ser
+ *        partilhados por vrias threads).
+ * @param grafo Apontador para o grafo.
+ * @param marcos Apontador para os marcos do grafo.
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @param custo Se no for NULL, recebe o custo do caminho (-1 se no existir).
+ * @return Nmero de vrtices do caminho, 0 se o destino no for alcanvel, ou -1 se
+ *         parmetros invlidos (incluindo marcos de outro grafo ou desatualizados) ou
+ *         faltar memria.
+ */
+int caminhoALT(ContextoProcura* ctx, const GR* grafo, const Marcos* marcos,
+    Vertice* origem, Vertice* destino, double* custo);
+
+/**
+ * @brief Grava os marcos num ficheiro binrio, identificando os vrtices pelo ID.
+ *
+ * @param marcos Apontador para os marcos.
+ * @param grafo Apontador para o grafo dos marcos.
+ * @param nomeFicheiro Nome do ficheiro a criar (substitudo se existir).
+ * @return 0 se sucesso, -1 se parmetros invlidos ou os marcos estiverem desatualizados,
+ *         -2 se no for possvel escrever o ficheiro.
+ */
+int guardarMarcos(const Marcos* marcos, const GR* grafo, const char* nomeFicheiro);
+
+/**
+ * @brief Carrega os marcos de um ficheiro gravado com `guardarMarcos`.
+ *
+ * Os vrtices so procurados pelo ID, pelo que o grafo pode ter sido carregado de outra
+ * forma (mapa ou ficheiro binrio), desde que tenha os mesmos vrtices e arestas. O
+ * ficheiro  recusado se o nmero de arestas ou a impresso digital das arestas (pontas e
+ * pesos) no forem os do grafo. As distncias tm de ser no negativas e finitas, ou -1
+ * (inalcanvel).
+ *
+ * @param grafo Apontador para o grafo.
+ * @param nomeFicheiro Nome do ficheiro.
+ * @return Apontador para os marcos, ou NULL se o ficheiro no existir, no for vlido,
+ *         no corresponder ao grafo ou faltar memria.
+ */
+Marcos* carregarMarcos(GR* grafo, const char* nomeFicheiro);
+
+#endif // FUNCOESMARCOS_H
@@ -0,0 +1,158 @@
+/**
+ * @file FuncoesMemoria.c
+ * @brief Implementao do alocador por blocos (pool) dos vrtices e arestas do grafo.
+ *
+ * @details
+ * Alocar cada vrtice e cada aresta com `malloc` torna a construo e a destruio de
+ * grafos grandes dominadas pelo alocador do sistema, e fragmenta a memria. O pool
+ * pede memria em blocos cujo tamanho duplica a cada novo bloco (at um limite),
+ * serve os elementos sequencialmente e guarda os elementos devolvidos numa lista
+ * de livres, ligada atravs do prprio espao do elemento.
+ *
+ * Como o nmero de blocos cresce de forma logartmica, libertar um grafo inteiro
+ * resume-se a um punhado de chamadas a `free`.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <stdlib.h>
+#include "Structs.h"
+#include "FuncoesMemoria.h"
+
+#define MAX_ELEMENTOS_POR_BLOCO ((size_t)1 << 20)
+
+/**
+ * @brief Inicializa um pool vazio; nenhuma memria  alocada at ao primeiro pedido.
+ *
+ * @param pool Apontador para o pool.
+ * @param tamanhoElemento Tamanho de cada elemento (no mnimo o de um apontador).
+ * @param elementosPorBloco Nmero de elementos do primeiro bloco.
+ */
+void iniciarPool(Pool* pool, size_t tamanhoElemento, size_t elementosPorBloco) {
+    if (!pool) return;
+    if (tamanhoElemento < sizeof(void*)) {
+        tamanhoElemento = sizeof(void*);  // espao para a ligao da lista de livres
+    }
+    pool->tamanhoElemento = tamanhoElemento;
+    pool->proximoBloco = elementosPorBloco > 0 ? elementosPorBloco : 1;
+    pool->blocos = NULL;
+    pool->posicao = NULL;
+    pool->fim = NULL;
+    pool->livres = NULL;
+}
+
+/**
+ * @brief Aloca um novo bloco com `numElementos` elementos e torna-o o bloco atual.
+ *
+ * Os elementos que sobravam no bloco anterior deixam de ser servidos.
+ *
+ * @return 0 se sucesso, -2 se falhar a alocao de memria.
+ */
+static int novoBloco(Pool* pool, size_t numElementos) {
+    BlocoPool* bloco = malloc(sizeof(BlocoPool) + numElementos * pool->tamanhoElemento);
+    if (!bloco) return -2;
+
+    bloco->capacidade = numElementos;
+    bloco->next = pool->blocos;
+    pool->blocos = bloco;
+    pool->posicao = (char*)(bloco + 1);
+    pool->fim = pool->posicao + numElementos * pool->tamanhoElemento;
+
+    if (pool->proximoBloco < MAX_ELEMENTOS_POR_BLOCO) {
+        pool->proximoBloco *= 2;
+    }
+    return 0;
+}
+
+/**
+ * @brief Obtm um elemento, dando prioridade aos elementos devolvidos.
+ *
+ * @param pool Apontador para o pool.
+ * @return Apontador para o elemento ou NULL se faltar memria.
+ */
+void* alocarDoPool(Pool* pool) {
+    if (!pool) return NULL;
+
+    if (pool->livres) {
+        void* elemento = pool->livres;
+        pool->livres = *(void**)elemento;
+        return elemento;
+    }
+    if (pool->posicao == pool->fim) {
+        if (novoBloco(pool, pool->proximoBloco) != 0) return NULL;
+    }
+    void* elemento = pool->posicao;
+    pool->posicao += pool->tamanhoElemento;
+    return elemento;
+}
+
+/**
+ * @brief Coloca um elemento na lista de livres do pool.
+ *
+ * @param pool Apontador para o pool.
+ * @param elemento Elemento obtido anteriormente com `alocarDoPool`.
+ */
+void devolverAoPool(Pool* pool, void* elemento) {
+    if (!pool || !elemento) return;
+    *(void**)elemento = pool->livres;
+    pool->livres = elemento;
+}
+
+/**
+ * @brief Garante espao contguo no bloco atual para `numElementos` elementos.
+ *
+ * til antes de criar muitos elementos de uma vez (por exemplo, ao carregar um mapa),
+ * para que fiquem num nico bloco.
+ *
+ * @param pool Apontador para o pool.
+ * @param numElementos Nmero de elementos a reservar.
+ * @return 0 se sucesso, -1 se o pool for invlido, -2 se falhar a alocao de memria.
+ */
+int reservarPool(Pool* pool, size_t numElementos) {
+    if (!pool) return -1;
+
+    size_t disponiveis = pool->posicao ? (size_t)(pool->fim - pool->posicao) / pool->tamanhoElemento : 0;
+    if (disponiveis >= numElementos) return 0;
+    return novoBloco(pool, numElementos > pool->proximoBloco ? numElementos : pool->proximoBloco);
+}
+
+/**
+ * @brief Obtm um vetor de elementos contguos, servido a partir do bloco atual.
+ *
+ * Permite que vrias threads inicializem elementos em paralelo, cada uma na sua
+ * parte do vetor, sem acederem ao pool.
+ *
+ * @param pool Apontador para o pool.
+ * @param numElementos Nmero de elementos do vetor.
+ * @return Apontador para o primeiro elemento ou NULL se faltar memria.
+ */
+void* alocarVetorDoPool(Pool* pool, size_t numElementos) {
+    if (!pool || numElementos == 0) return NULL;
+    if (reservarPool(pool, numElementos) != 0) return NULL;
+
+    void* vetor = pool->posicao;
+    pool->posicao += numElementos * pool->tamanhoElemento;
+    return vetor;
+}
+
+/**
+ * @brief Liberta todos os blocos do pool e deixa-o vazio, pronto a ser reutilizado.
+ *
+ * @param pool Apontador para o pool.
+ */
+void libertarPool(Pool* pool) {
+    if (!pool) return;
+
+    BlocoPool* bloco = pool->blocos;
+    while (bloco) {
+        BlocoPool* tmp = bloco;
+        bloco = bloco->next;
+        free(tmp);
+    }
+    pool->blocos = NULL;
+    pool->posicao = NULL;
+    pool->fim = NULL;
+    pool->livres = NULL;
+}
@@ -0,0 +1,71 @@
+#ifndef FUNCOESMEMORIA_H
+#define FUNCOESMEMORIA_H
+
+/**
+ * @file FuncoesMemoria.h
+ * @brief Declarao das funes do alocador por blocos (pool) usado pelo grafo.
+ *
+ * Um pool serve elementos de tamanho fixo a partir de blocos grandes, reutiliza os
+ * elementos devolvidos e liberta tudo de uma vez com poucas chamadas a `free`.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <stddef.h>
+#include "Structs.h"
+
+ /**
+  * @brief Inicializa um pool vazio.
+  *
+  * @param pool Apontador para o pool a inicializar.
+  * @param tamanhoElemento Tamanho de cada elemento, em bytes.
+  * @param elementosPorBloco Nmero de elementos do primeiro bloco (os seguintes crescem).
+  */
+void iniciarPool(Pool* pool, size_t tamanhoElemento, size_t elementosPorBloco);
+
+/**
+ * @brief Obtm um elemento do pool.
+ *
+ * @param pool Apontador para o pool.
+ * @return Apontador para o elemento (no inicializado) ou NULL se faltar memria.
+ */
+void* alocarDoPool(Pool* pool);
+
+/**
+ * @brief Devolve um elemento ao pool para ser reutilizado.
+ *
+ * @param pool Apontador para o pool de onde o elemento foi obtido.
+ * @param elemento Apontador para o elemento a devolver.
+ */
+void devolverAoPool(Pool* pool, void* elemento);
+
+/**
+ * @brief Garante que as prximas `numElementos` alocaes no precisam de memria nova.
+ *
+ * @param pool Apontador para o pool.
+ * @param numElementos Nmero de elementos a reservar.
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se falhar a alocao de memria.
+ */
+int reservarPool(Pool* pool, size_t numElementos);
+
+/**
+ * @brief Obtm `numElementos` elementos contguos do pool, como um vetor.
+ *
+ * Os elementos podem depois ser devolvidos um a um com `devolverAoPool`.
+ *
+ * @param pool Apontador para o pool.
+ * @param numElementos Nmero de elementos.
+ * @return Apontador para o primeiro elemento ou NULL se faltar memria.
+ */
+void* alocarVetorDoPool(Pool* pool, size_t numElementos);
+
+/**
+ * @brief Liberta todos os blocos do pool, invalidando todos os elementos obtidos dele.
+ *
+ * @param pool Apontador para o pool.
+ */
+void libertarPool(Pool* pool);
+
+#endif // FUNCOESMEMORIA_H
@@ -0,0 +1,100 @@
+/**
+ * @file FuncoesSaida.c
+ * @brief Implementao da escrita de texto com buffer.
+ *
+ * @details
+ * O texto  formatado diretamente para o fim do buffer com `vsnprintf`. Se no couber,
+ * o buffer  despejado e a formatao repetida; um texto maior do que o buffer inteiro
+ *  escrito diretamente no ficheiro.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include "Structs.h"
+#include "FuncoesSaida.h"
+
+#define CAPACIDADE_SAIDA_OMISSAO ((size_t)1 << 20)
+
+/**
+ * @brief Prepara uma sada com buffer para um ficheiro.
+ *
+ * @param saida Apontador para a sada a preparar.
+ * @param ficheiro Ficheiro de destino.
+ * @param capacidade Tamanho do buffer em bytes (0 para o tamanho por omisso).
+ * @return 0 se sucesso, -1 se parmetros invlidos, -2 se faltar memria.
+ */
+int iniciarSaida(SaidaBuffer* saida, FILE* ficheiro, size_t capacidade) {
+    if (!saida || !ficheiro) return -1;
+    if (capacidade == 0) capacidade = CAPACIDADE_SAIDA_OMISSAO;
+
+    saida->dados = malloc(capacidade);
+    if (!saida->dados) return -2;
+    saida->ficheiro = ficheiro;
+    saida->usado = 0;
+    saida->capacidade = capacidade;
+    return 0;
+}
+
+/**
+ * @brief Escreve texto formatado no buffer, despejando-o se no houver espao.
+ *
+ * @param saida Apontador para a sada.
+ * @param formato Formato, como em `printf`.
+ * @return 0 se sucesso, -1 em caso de erro de escrita.
+ */
+int escreverSaida(SaidaBuffer* saida, const char* formato, ...) {
+    va_list args;
+    for (int tentativa = 0; tentativa < 2; tentativa++) {
+        size_t livre = saida->capacidade - saida->usado;
+        va_start(args, formato);
+        int n = vsnprintf(saida->dados + saida->usado, livre, formato, args);
+        va_end(args);
+        if (n < 0) return -1;
+        if ((size_t)n < livre) {  // coube (vsnprintf precisa tambm de espao para o '\0')
+            saida->usado += (size_t)n;
+            return 0;
+        }
+        if (despejarSaida(saida) != 0) return -1;
+    }
+
+    // maior do que o buffer inteiro: escrever diretamente
+    va_start(args, formato);
+    int n = vfprintf(saida->ficheiro, formato, args);
+    va_end(args);
+    return n < 0 ? -1 : 0;
+}
+
+/**
+ * @brief Escreve no ficheiro o contedo do buffer e esvazia-o.
+ *
+ * @param saida Apontador para a sada.
+ * @return 0 se sucesso, -1 em caso de erro de escrita.
+ */
+int despejarSaida(SaidaBuffer* saida) {
+    if (!saida) return -1;
+    size_t usado = saida->usado;
+    saida->usado = 0;
+    if (usado > 0 && fwrite(saida->dados, 1, usado, saida->ficheiro) != usado) return -1;
+    return 0;
+}
+
+/**
+ * @brief Despeja o buffer e liberta a sua memria.
+ *
+ * @param saida Apontador para a sada.
+ * @return 0 se sucesso, -1 em caso de erro de escrita.
+ */
+int terminarSaida(SaidaBuffer* saida) {
+    if (!saida) return -1;
+    int resultado = despejarSaida(saida);
+    if (fflush(saida->ficheiro) != 0) resultado = -1;
+    free(saida->dados);
+    saida->dados = NULL;
+    saida->capacidade = 0;
+    return resultado;
+}
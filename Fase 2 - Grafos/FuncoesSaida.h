@@ -0,0 +1,54 @@
+#ifndef FUNCOESSAIDA_H
+#define FUNCOESSAIDA_H
+
+/**
+ * @file FuncoesSaida.h
+ * @brief Declarao das funes de escrita de texto com buffer.
+ *
+ * Imprimir milhes de vrtices com um `printf` por linha faz com que o tempo de uma
+ * procura seja quase todo de escrita. Uma `SaidaBuffer` junta o texto num buffer
+ * grande e s o escreve no ficheiro quando este enche ou quando a sada termina.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "Structs.h"
+
+ /**
+  * @brief Prepara uma sada com buffer para um ficheiro.
+  *
+  * @param saida Apontador para a sada a preparar.
+  * @param ficheiro Ficheiro de destino (por exemplo, stdout).
+  * @param capacidade Tamanho do buffer em bytes (0 para o tamanho por omisso, 1 MiB).
+  * @return 0 se sucesso, -1 se parmetros invlidos, -2 se faltar memria.
+  */
+int iniciarSaida(SaidaBuffer* saida, FILE* ficheiro, size_t capacidade);
+
+/**
+ * @brief Escreve texto formatado (como `printf`) no buffer da sada.
+ *
+ * @param saida Apontador para a sada.
+ * @param formato Formato, como em `printf`.
+ * @return 0 se sucesso, -1 em caso de erro de escrita.
+ */
+int escreverSaida(SaidaBuffer* saida, const char* formato, ...);
+
+/**
+ * @brief Escreve no ficheiro todo o texto que est no buffer.
+ *
+ * @param saida Apontador para a sada.
+ * @return 0 se sucesso, -1 em caso de erro de escrita.
+ */
+int despejarSaida(SaidaBuffer* saida);
+
+/**
+ * @brief Despeja o buffer e liberta a sua memria. O ficheiro no  fechado.
+ *
+ * @param saida Apontador para a sada.
+ * @return 0 se sucesso, -1 em caso de erro de escrita.
+ */
+int terminarSaida(SaidaBuffer* saida);
+
+#endif // FUNCOESSAIDA_H
@@ -0,0 +1,230 @@
+/**
+ * @file FuncoesSimd.c
+ * @brief Implementao das funes vetorizadas de leitura do mapa.
+ *
+ * @details
+ * Cada funo tem trs verses: escalar, SSE2 (16 caracteres por comparao) e AVX2
+ * (32 caracteres). A comparao com '.' d uma mscara de bits com um bit por
+ * caractere; s os bits a 0 (clulas ocupadas ou quebras de linha) interessam ao
+ * chamador. A verso  escolhida uma nica vez, na primeira chamada, pelo que o
+ * mesmo executvel corre em qualquer processador.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "FuncoesSimd.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+ // GCC e Clang s geram instrues AVX2 em funes marcadas para isso
+#if defined(__GNUC__) || defined(__clang__)
+#define ALVO_SSE2 __attribute__((target("sse2")))
+#define ALVO_AVX2 __attribute__((target("avx2")))
+#else
+#define ALVO_SSE2
+#define ALVO_AVX2
+#endif
+
+typedef const char* (*FuncaoProcura)(const char* p, const char* fim);
+typedef size_t (*FuncaoContagem)(const char* dados, size_t tamanho);
+
+static int nivel = -1;
+static FuncaoProcura procurar;
+static FuncaoContagem contar;
+
+/* ----------------------------- verso escalar ----------------------------- */
+
+static const char* procurarEscalar(const char* p, const char* fim) {
+    while (p < fim && *p == '.') p++;
+    return p;
+}
+
+static size_t contarEscalar(const char* dados, size_t tamanho) {
+    size_t total = 0;
+    for (size_t i = 0; i < tamanho; i++) {
+        total += (dados[i] != '.' && dados[i] != '\n');
+    }
+    return total;
+}
+
+#ifdef SIMD_X86
+
+/**
+ * @brief ndice do bit a 1 menos significativo (m != 0).
+ */
+static int primeiroBit(unsigned int m) {
+#ifdef _MSC_VER
+    unsigned long i;
+    _BitScanForward(&i, m);
+    return (int)i;
+#else
+    return __builtin_ctz(m);
+#endif
+}
+
+/* ------------------------------ verso SSE2 ------------------------------- */
+
+ALVO_SSE2
+static const char* procurarSse2(const char* p, const char* fim) {
+    const __m128i ponto = _mm_set1_epi8('.');
+    while (fim - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)p);
+        unsigned int vazias = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, ponto));
+        if (vazias != 0xFFFFu) return p + primeiroBit(~vazias);
+        p += 16;
+    }
+    return procurarEscalar(p, fim);
+}
+
+/**
+ * @brief Conta com SSE2.
+ *
+ * As comparaes do -1 por caractere vazio; subtra-las acumula contadores de 8 bits,
+ * que so somados (_mm_sad_epu8) a cada 255 blocos, antes de poderem transbordar.
+ */
+ALVO_SSE2
+static size_t contarSse2(const char* dados, size_t tamanho) {
+    const __m128i ponto = _mm_set1_epi8('.');
+    const __m128i quebra = _mm_set1_epi8('\n');
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0, vazias = 0;
+
+    while (tamanho - i >= 16) {
+        size_t limite = (tamanho - i) / 16 > 255 ? i + 255 * 16 : tamanho;
+        __m128i acumulado = zero;
+        for (; i + 16 <= limite; i += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i*)(dados + i));
+            __m128i vazia = _mm_or_si128(_mm_cmpeq_epi8(v, ponto), _mm_cmpeq_epi8(v, quebra));
+            acumulado = _mm_sub_epi8(acumulado, vazia);
+        }
+        __m128i soma = _mm_sad_epu8(acumulado, zero);
+        vazias += (size_t)_mm_cvtsi128_si32(soma) + (size_t)_mm_cvtsi128_si32(_mm_srli_si128(soma, 8));
+    }
+    return (i - vazias) + contarEscalar(dados + i, tamanho - i);
+}
+
+/* ------------------------------ verso AVX2 ------------------------------- */
+
+ALVO_AVX2
+static const char* procurarAvx2(const char* p, const char* fim) {
+    const __m256i ponto = _mm256_set1_epi8('.');
+    while (fim - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)p);
+        unsigned int vazias = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, ponto));
+        if (vazias != 0xFFFFFFFFu) return p + primeiroBit(~vazias);
+        p += 32;
+    }
+    return procurarSse2(p, fim);
+}
+
+ALVO_AVX2
+static size_t contarAvx2(const char* dados, size_t tamanho) {
+    const __m256i ponto = _mm256_set1_epi8('.');
+    const __m256i quebra = _mm256_set1_epi8('\n');
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0, vazias = 0;
+
+    while (tamanho - i >= 32) {
+        size_t limite = (tamanho - i) / 32 > 255 ? i + 255 * 32 : tamanho;
+        __m256i acumulado = zero;
+        for (; i + 32 <= limite; i += 32) {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(dados + i));
+            __m256i vazia = _mm256_or_si256(_mm256_cmpeq_epi8(v, ponto), _mm256_cmpeq_epi8(v, quebra));
+            acumulado = _mm256_sub_epi8(acumulado, vazia);
+        }
+        __m256i soma = _mm256_sad_epu8(acumulado, zero);
+        __m128i metade = _mm_add_epi64(_mm256_castsi256_si128(soma), _mm256_extracti128_si256(soma, 1));
+        vazias += (size_t)_mm_cvtsi128_si32(metade) + (size_t)_mm_cvtsi128_si32(_mm_srli_si128(metade, 8));
+    }
+    return (i - vazias) + contarSse2(dados + i, tamanho - i);
+}
+
+/**
+ * @brief Deteta o melhor conjunto de instrues suportado pelo processador e pelo sistema.
+ */
+static int detetarNivel(void) {
+#ifdef _MSC_VER
+    int r[4];
+    __cpuid(r, 0);
+    int maximo = r[0];
+    __cpuid(r, 1);
+    int sse2 = (r[3] >> 26) & 1;
+    int osxsave = (r[2] >> 27) & 1;
+    int avx = (r[2] >> 28) & 1;
+    if (maximo >= 7 && osxsave && avx && (_xgetbv(0) & 6) == 6) {  // registos YMM guardados pelo SO
+        __cpuidex(r, 7, 0);
+        if ((r[1] >> 5) & 1) return 2;
+    }
+    return sse2 ? 1 : 0;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return 2;
+    if (__builtin_cpu_supports("sse2")) return 1;
+    return 0;
+#endif
+}
+
+#else
+
+static int detetarNivel(void) {
+    return 0;
+}
+
+#endif // SIMD_X86
+
+/**
+ * @brief Devolve o nvel vetorial em uso, escolhendo as funes na primeira chamada.
+ *
+ * @return 0 se escalar, 1 se SSE2, 2 se AVX2.
+ */
+int nivelSimd(void) {
+    if (nivel >= 0) return nivel;
+
+    int n = detetarNivel();
+    procurar = procurarEscalar;
+    contar = contarEscalar;
+#ifdef SIMD_X86
+    if (n == 2) {
+        procurar = procurarAvx2;
+        contar = contarAvx2;
+    }
+    else if (n == 1) {
+        procurar = procurarSse2;
+        contar = contarSse2;
+    }
+#endif
+    nivel = n;
+    return nivel;
+}
+
+/**
+ * @brief Procura o prximo caractere diferente de '.' (antena ou quebra de linha).
+ *
+ * @param p Incio da procura.
+ * @param fim Fim do contedo (exclusivo).
+ * @return Apontador para o caractere encontrado ou `fim` se no existir.
+ */
+const char* proximaCelulaOcupada(const char* p, const char* fim) {
+    if (nivel < 0) nivelSimd();
+    return procurar(p, fim);
+}
+
+/**
+ * @brief Conta os caracteres que no so '.' nem '\n'.
+ *
+ * @param dados Contedo a percorrer.
+ * @param tamanho Nmero de caracteres.
+ * @return Nmero de caracteres contados.
+ */
+size_t contarCelulasOcupadas(const char* dados, size_t tamanho) {
+    if (nivel < 0) nivelSimd();
+    return contar(dados, tamanho);
+}
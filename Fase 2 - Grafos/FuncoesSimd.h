@@ -0,0 +1,53 @@
+#ifndef FUNCOESSIMD_H
+#define FUNCOESSIMD_H
+
+/**
+ * @file FuncoesSimd.h
+ * @brief Declarao das funes vetorizadas de leitura do mapa.
+ *
+ * Os mapas so quase todos '.', pelo que o custo da leitura est em saltar clulas
+ * vazias. Estas funes comparam 16 (SSE2) ou 32 (AVX2) caracteres de cada vez; a
+ * verso usada  escolhida em tempo de execuo conforme o processador, com uma
+ * verso escalar para os restantes casos.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <stddef.h>
+
+/**
+ * @brief Devolve o nvel de instrues vetoriais usado pelas funes deste mdulo.
+ *
+ * Faz a deteo do processador na primeira chamada. Deve ser chamada antes de lanar
+ * threads que usem as restantes funes, para que a escolha j esteja feita.
+ *
+ * @return 0 se escalar, 1 se SSE2, 2 se AVX2.
+ */
+int nivelSimd(void);
+
+/**
+ * @brief Procura o prximo caractere diferente de '.'.
+ *
+ * Para alm das antenas, pra tambm nas quebras de linha ('\n' e '\r').
+ *
+ * @param p Incio da procura.
+ * @param fim Fim do contedo (exclusivo).
+ * @return Apontador para o caractere encontrado ou `fim` se no existir.
+ */
+const char* proximaCelulaOcupada(const char* p, const char* fim);
+
+/**
+ * @brief Conta os caracteres que no so '.' nem '\n'.
+ *
+ *  um majorante do nmero de antenas (um '\r' antes de '\n' tambm  contado),
+ * usado para reservar memria antes da leitura.
+ *
+ * @param dados Contedo a percorrer.
+ * @param tamanho Nmero de caracteres.
+ * @return Nmero de caracteres contados.
+ */
+size_t contarCelulasOcupadas(const char* dados, size_t tamanho);
+
+#endif // FUNCOESSIMD_H
@@ -0,0 +1,206 @@
+/**
+ * @file FuncoesThreads.c
+ * @brief Implementao da execuo paralela (fork-join) e das operaes atmicas.
+ *
+ * @details
+ * Em Windows usa `CreateThread` e as funes `Interlocked*`; nos restantes sistemas
+ * usa pthreads e as operaes atmicas do GCC/Clang. O resto do programa s v
+ * `executarEmParalelo`, que lana as threads, executa a tarefa e espera por todas.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <stdlib.h>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+#include "FuncoesThreads.h"
+
+/**
+ * @brief Argumentos de cada thread lanada por `executarEmParalelo`.
+ */
+typedef struct ArgumentoThread {
+    TarefaParalela tarefa;
+    void* dados;
+    int indice;
+    int total;
+} ArgumentoThread;
+
+#ifdef _WIN32
+static DWORD WINAPI arrancarThread(LPVOID arg) {
+    ArgumentoThread* a = arg;
+    a->tarefa(a->dados, a->indice, a->total);
+    return 0;
+}
+#else
+static void* arrancarThread(void* arg) {
+    ArgumentoThread* a = arg;
+    a->tarefa(a->dados, a->indice, a->total);
+    return NULL;
+}
+#endif
+
+/**
+ * @brief Devolve o nmero de processadores lgicos do sistema.
+ *
+ * @return Nmero de processadores, no mnimo 1.
+ */
+int numeroProcessadores(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+/**
+ * @brief Executa `tarefa` em paralelo e espera por todas as threads.
+ *
+ * Se no for possvel criar alguma thread (ou faltar memria para as criar), as
+ * tarefas em falta so executadas pela thread que chama, pelo que todas as partes
+ * do trabalho so sempre feitas.
+ *
+ * @param tarefa Funo a executar.
+ * @param dados Dados partilhados.
+ * @param numThreads Nmero de threads (se <= 0, usa o nmero de processadores).
+ * @return 0 se sucesso, -1 se a tarefa for NULL.
+ */
+int executarEmParalelo(TarefaParalela tarefa, void* dados, int numThreads) {
+    if (!tarefa) return -1;
+    if (numThreads <= 0) numThreads = numeroProcessadores();
+    if (numThreads == 1) {
+        tarefa(dados, 0, 1);
+        return 0;
+    }
+
+    ArgumentoThread* args = malloc((size_t)numThreads * sizeof(ArgumentoThread));
+#ifdef _WIN32
+    HANDLE* threads = malloc((size_t)numThreads * sizeof(HANDLE));
+#else
+    pthread_t* threads = malloc((size_t)numThreads * sizeof(pthread_t));
+#endif
+    char* criada = calloc((size_t)numThreads, sizeof(char));
+    if (!args || !threads || !criada) {
+        free(args);
+        free(threads);
+        free(criada);
+        for (int i = 0; i < numThreads; i++) tarefa(dados, i, numThreads);  // tudo nesta thread
+        return 0;
+    }
+
+    for (int i = 0; i < numThreads; i++) {
+        args[i].tarefa = tarefa;
+        args[i].dados = dados;
+        args[i].indice = i;
+        args[i].total = numThreads;
+    }
+    for (int i = 1; i < numThreads; i++) {
+#ifdef _WIN32
+        threads[i] = CreateThread(NULL, 0, arrancarThread, &args[i], 0, NULL);
+        criada[i] = threads[i] != NULL;
+#else
+        criada[i] = pthread_create(&threads[i], NULL, arrancarThread, &args[i]) == 0;
+#endif
+    }
+
+    tarefa(dados, 0, numThreads);
+    for (int i = 1; i < numThreads; i++) {
+        if (!criada[i]) {
+            tarefa(dados, i, numThreads);  // sem thread: executa aqui
+            continue;
+        }
+#ifdef _WIN32
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+#else
+        pthread_join(threads[i], NULL);
+#endif
+    }
+
+    free(args);
+    free(threads);
+    free(criada);
+    return 0;
+}
+
+/**
+ * @brief Compare-and-swap de um apontador.
+ *
+ * @param destino Endereo do apontador.
+ * @param esperado Valor esperado.
+ * @param novo Novo valor.
+ * @return 1 se `*destino` valia `esperado` e passou a valer `novo`, 0 caso contrrio.
+ */
+int compararETrocarApontador(void* volatile* destino, void* esperado, void* novo) {
+#ifdef _WIN32
+    return InterlockedCompareExchangePointer(destino, novo, esperado) == esperado;
+#else
+    return __sync_bool_compare_and_swap(destino, esperado, novo);
+#endif
+}
+
+/**
+ * @brief Compare-and-swap de um inteiro.
+ *
+ * @param destino Endereo do inteiro.
+ * @param esperado Valor esperado.
+ * @param novo Novo valor.
+ * @return 1 se `*destino` valia `esperado` e passou a valer `novo`, 0 caso contrrio.
+ */
+int compararETrocarInteiro(volatile int* destino, int esperado, int novo) {
+#ifdef _WIN32
+    return InterlockedCompareExchange((volatile LONG*)destino, novo, esperado) == esperado;
+#else
+    return __sync_bool_compare_and_swap(destino, esperado, novo);
+#endif
+}
+
+/**
+ * @brief Soma atomicamente um valor a um inteiro.
+ *
+ * @param destino Endereo do inteiro.
+ * @param valor Valor a somar.
+ * @return Valor de `*destino` antes da soma.
+ */
+int somarAtomicoInteiro(volatile int* destino, int valor) {
+#ifdef _WIN32
+    return InterlockedExchangeAdd((volatile LONG*)destino, valor);
+#else
+    return __sync_fetch_and_add(destino, valor);
+#endif
+}
+
+/**
+ * @brief L um inteiro que outras threads podem estar a alterar atomicamente.
+ *
+ * @param origem Endereo do inteiro.
+ * @return Valor lido.
+ */
+int lerAtomicoInteiro(const volatile int* origem) {
+#ifdef _WIN32
+    return *origem;  // leituras volatile tm semntica de aquisio no MSVC (x86/x64)
+#else
+    return __atomic_load_n(origem, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/**
+ * @brief Cede o processador a outra thread.
+ */
+void cederProcessador(void) {
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
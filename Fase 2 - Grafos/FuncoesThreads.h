@@ -0,0 +1,86 @@
+#ifndef FUNCOESTHREADS_H
+#define FUNCOESTHREADS_H
+
+/**
+ * @file FuncoesThreads.h
+ * @brief Declarao das funes de execuo paralela e operaes atmicas.
+ *
+ * Esconde as diferenas entre as threads de Windows e as pthreads de POSIX atrs
+ * de uma nica funo de execuo paralela (fork-join) e de operaes atmicas simples.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+ /**
+  * @brief Funo executada por cada thread de uma execuo paralela.
+  *
+  * @param dados Apontador partilhado por todas as threads.
+  * @param indiceThread ndice da thread (0 .. numThreads-1).
+  * @param numThreads Nmero total de threads.
+  */
+typedef void (*TarefaParalela)(void* dados, int indiceThread, int numThreads);
+
+/**
+ * @brief Devolve o nmero de processadores lgicos disponveis.
+ *
+ * @return Nmero de processadores (pelo menos 1).
+ */
+int numeroProcessadores(void);
+
+/**
+ * @brief Executa uma tarefa em `numThreads` threads e espera que todas terminem.
+ * A thread que chama executa a tarefa com ndice 0.
+ *
+ * @param tarefa Funo a executar.
+ * @param dados Apontador passado a todas as threads.
+ * @param numThreads Nmero de threads (se <= 0, usa o nmero de processadores).
+ * @return 0 se sucesso, -1 se a tarefa for NULL. As partes que no puderem correr noutra
+ * thread so executadas pela thread que chama.
+ */
+int executarEmParalelo(TarefaParalela tarefa, void* dados, int numThreads);
+
+/**
+ * @brief Troca atomicamente um apontador se ainda tiver o valor esperado.
+ *
+ * @param destino Endereo do apontador.
+ * @param esperado Valor esperado.
+ * @param novo Novo valor.
+ * @return 1 se a troca foi feita, 0 caso contrrio.
+ */
+int compararETrocarApontador(void* volatile* destino, void* esperado, void* novo);
+
+/**
+ * @brief Troca atomicamente um inteiro se ainda tiver o valor esperado.
+ *
+ * @param destino Endereo do inteiro.
+ * @param esperado Valor esperado.
+ * @param novo Novo valor.
+ * @return 1 se a troca foi feita, 0 caso contrrio.
+ */
+int compararETrocarInteiro(volatile int* destino, int esperado, int novo);
+
+/**
+ * @brief Soma atomicamente um valor a um inteiro.
+ *
+ * @param destino Endereo do inteiro.
+ * @param valor Valor a somar.
+ * @return Valor anterior de `*destino`.
+ */
+int somarAtomicoInteiro(volatile int* destino, int valor);
+
+/**
+ * @brief L atomicamente um inteiro alterado por outras threads.
+ *
+ * @param origem Endereo do inteiro.
+ * @return Valor lido.
+ */
+int lerAtomicoInteiro(const volatile int* origem);
+
+/**
+ * @brief Cede o processador a outra thread pronta a correr (usado em esperas ativas).
+ */
+void cederProcessador(void);
+
+#endif // FUNCOESTHREADS_H
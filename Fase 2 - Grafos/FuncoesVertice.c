@@ -21,18 +21,26 @@
 #include "Structs.h"
 #include "FuncoesVertice.h"
 #include "FuncoesAresta.h"
+#include "FuncoesIndice.h"
+#include "FuncoesMemoria.h"
+#include "FuncoesComponentes.h"
 
  /**
   * @brief Cria um novo vrtice com os dados fornecidos.
   *
+  * O vrtice  obtido do pool de vrtices do grafo, mas s passa a fazer parte
+  * do grafo depois de `adicionarVertice`.
+  *
+  * @param grafo Apontador para o grafo a que o vrtice vai pertencer.
   * @param id Identificador nico do vrtice.
   * @param frequencia Carcter que representa a frequncia do vrtice.
   * @param x Coordenada X do vrtice.
   * @param y Coordenada Y do vrtice.
   * @return Apontador para o vrtice criado, ou NULL em caso de falha na alocao.
   */
-Vertice* criarVertice(int id, char frequencia, int x, int y) {
-    Vertice* v = malloc(sizeof(Vertice));
+Vertice* criarVertice(GR* grafo, int id, char frequencia, int x, int y) {
+    if (!grafo) return NULL;
+    Vertice* v = alocarDoPool(&grafo->poolVertices);
     if (!v) {
         return NULL; // falha na alocao
     }
@@ -41,22 +49,52 @@ Vertice* criarVertice(int id, char frequencia, int x, int y) {
     v->x = x;
     v->y = y;
     v->visitado = 0;
+    v->indice = -1;
     v->adj = NULL;
     v->next = NULL;
+    v->prev = NULL;
     return v;
 }
 
+/**
+ * @brief Devolve ao pool do grafo um vrtice criado mas que no foi adicionado.
+ *
+ * @param grafo Apontador para o grafo onde o vrtice foi criado.
+ * @param v Apontador para o vrtice a libertar.
+ */
+void libertarVertice(GR* grafo, Vertice* v) {
+    if (!grafo || !v) return;
+    devolverAoPool(&grafo->poolVertices, v);
+}
+
 /**
  * @brief Adiciona um vrtice ao grafo.
  *
- * Atualiza as dimenses do grafo se necessrio.
+ * Atualiza as dimenses do grafo se necessrio e regista o vrtice nos ndices
+ * de coordenadas e de IDs, para que possa ser encontrado em tempo constante.
+ * O vrtice  ligado ao fim da lista atravs do apontador `ultimo` do grafo.
  *
  * @param grafo Apontador para o grafo onde o vrtice ser adicionado.
  * @param vertice Apontador para o vrtice a adicionar.
- * @return 0 em caso de sucesso, -1 em caso de erro (Apontadores NULL).
+ * @return 0 em caso de sucesso, -1 em caso de erro (Apontadores NULL ou ID negativo),
+ *         -2 se falhar a alocao dos ndices, -3 se a posio j estiver ocupada,
+ *         -4 se o ID j estiver em uso.
  */
 int adicionarVertice(GR* grafo, Vertice* vertice) {
-    if (!grafo || !vertice) return -1;
+    if (!grafo || !vertice || vertice->id < 0) return -1;
+    if (consultarId(grafo, vertice->id)) return -4;
+
+    int r = indexarCoordenadas(grafo, vertice);
+    if (r != 0) return r;
+    r = indexarId(grafo, vertice);
+    if (r == 0) {
+        r = indexarDenso(grafo, vertice);
+        if (r != 0) desindexarId(grafo, vertice);
+    }
+    if (r != 0) {
+        desindexarCoordenadas(grafo, vertice);
+        return r;
+    }
 
     if (vertice->x > grafo->colunas) {
         grafo->colunas = vertice->x;
@@ -65,17 +103,17 @@ int adicionarVertice(GR* grafo, Vertice* vertice) {
         grafo->linhas = vertice->y;
     }
 
-    if (grafo->vertices == NULL) {
+    vertice->next = NULL;
+    vertice->prev = grafo->ultimo;
+    if (grafo->ultimo == NULL) {
         grafo->vertices = vertice;
     }
     else {
-        Vertice* temp = grafo->vertices;
-        while (temp->next != NULL) {
-            temp = temp->next;
-        }
-        temp->next = vertice;
+        grafo->ultimo->next = vertice;
     }
+    grafo->ultimo = vertice;
     grafo->numVertices++;
+    acrescentarComponente(grafo, vertice);
     return 0;
 }
 
@@ -106,6 +144,9 @@ void listarVertices(GR* grafo) {
 /**
  * @brief Procura um vrtice no grafo pelas coordenadas (x, y).
  *
+ * Usa o ndice de coordenadas do grafo, pelo que o custo  constante
+ * e no depende do nmero de vrtices.
+ *
  * @param grafo Apontador para o grafo.
  * @param x Coordenada X a procurar.
  * @param y Coordenada Y a procurar.
@@ -113,12 +154,7 @@ void listarVertices(GR* grafo) {
  */
 Vertice* procurarVerticePorCoordenadas(GR* grafo, int x, int y) {
     if (!grafo) return NULL;
-    Vertice* v = grafo->vertices;
-    while (v != NULL) {
-        if (v->x == x && v->y == y) return v;
-        v = v->next;
-    }
-    return NULL;
+    return consultarCoordenadas(grafo, x, y);
 }
 
 /**
@@ -137,52 +173,130 @@ int alterarFrequenciaVertice(Vertice* v, char novaFreq) {
 /**
  * @brief Procura um vrtice no grafo pelo seu ID.
  *
+ * Usa a tabela de IDs do grafo, com custo constante independente do nmero de vrtices.
+ *
  * @param grafo Apontador para o grafo.
  * @param id ID do vrtice a procurar.
  * @return Apontador para o vrtice encontrado, ou NULL se no existir.
  */
 Vertice* procurarVerticePorId(GR* grafo, int id) {
     if (!grafo) return NULL;
-    Vertice* v = grafo->vertices;
-    while (v != NULL) {
-        if (v->id == id) return v;
-        v = v->next;
+    return consultarId(grafo, id);
+}
+
+/**
+ * @brief Retira um vrtice da lista do grafo e dos ndices, sem mexer nas arestas.
+ *
+ * O vrtice  desligado da lista atravs dos apontadores `prev`/`next`, sem procurar
+ * o seu antecessor.
+ */
+static void retirarDaLista(GR* grafo, Vertice* atual) {
+    if (atual->prev == NULL) {
+        grafo->vertices = atual->next;
     }
-    return NULL;
+    else {
+        atual->prev->next = atual->next;
+    }
+    if (atual->next == NULL) {
+        grafo->ultimo = atual->prev;
+    }
+    else {
+        atual->next->prev = atual->prev;
+    }
+
+    desindexarCoordenadas(grafo, atual);
+    desindexarId(grafo, atual);
+    desindexarDenso(grafo, atual);
+    invalidarComponentes(grafo);  // a remoo muda os ndices densos
+    atual->prev = atual->next = NULL;
+    grafo->numVertices--;
 }
 
 /**
  * @brief Remove um vrtice do grafo pelo seu ID.
  *
- * Tambm remove todas as arestas associadas a este vrtice.
+ * Tambm remove todas as arestas associadas a este vrtice. O vrtice  encontrado
+ * pela tabela de IDs e desligado da lista atravs dos apontadores `prev`/`next`,
+ * sem procurar o seu antecessor. A memria volta aos pools do grafo.
  *
  * @param grafo Apontador para o grafo.
  * @param id ID do vrtice a remover.
  * @return 0 em caso de sucesso, -1 se o vrtice no for encontrado ou grafo invlido.
+ *
+ * @details
+ * As arestas que apontam para o vrtice so procuradas em todo o grafo, pelo que esta
+ * funo funciona com quaisquer arestas. Se as arestas forem simtricas (como as criadas
+ * por `criarArestasAdjacentes`), `removerVerticeComArestas` faz o mesmo em tempo constante.
  */
 int removerVerticePorId(GR* grafo, int id) {
-    if (!grafo || !grafo->vertices) return -1;
-
-    Vertice* atual = grafo->vertices;
-    Vertice* anterior = NULL;
-
-    while (atual) {
-        if (atual->id == id) {
-            if (anterior == NULL) {
-                grafo->vertices = atual->next;
-            }
-            else {
-                anterior->next = atual->next;
-            }
-
-            removerArestasParaVertice(grafo, atual);
-            libertarArestasDoVertice(atual);
-            free(atual);
-            grafo->numVertices--;
-            return 0;
-        }
-        anterior = atual;
-        atual = atual->next;
+    if (!grafo) return -1;
+
+    Vertice* atual = consultarId(grafo, id);
+    if (!atual) return -1; // no encontrado
+
+    retirarDaLista(grafo, atual);
+    removerArestasParaVertice(grafo, atual);
+    libertarArestasDoVertice(grafo, atual);
+    devolverAoPool(&grafo->poolVertices, atual);
+    return 0;
+}
+
+/**
+ * @brief Adiciona um vrtice ao grafo e liga-o logo aos vizinhos adjacentes com a mesma frequncia.
+ *
+ * Substitui a sequncia `adicionarVertice` + `criarArestasAdjacentes`, que percorre o
+ * grafo inteiro: aqui s so consultadas as 8 posies  volta do novo vrtice.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param vertice Apontador para o vrtice a adicionar.
+ * @return Os cdigos de `adicionarVertice`, ou -5 se faltar memria para as arestas
+ *         (nesse caso o vrtice no fica no grafo e as dimenses do grafo so repostas).
+ */
+int adicionarVerticeComArestas(GR* grafo, Vertice* vertice) {
+    if (!grafo) return -1;
+
+    // Dimenses anteriores, repostas se o vrtice no puder ficar no grafo
+    int linhas = grafo->linhas;
+    int colunas = grafo->colunas;
+
+    int resultado = adicionarVertice(grafo, vertice);
+    if (resultado != 0) {
+        grafo->linhas = linhas;
+        grafo->colunas = colunas;
+        return resultado;
+    }
+
+    if (ligarVizinhosAdjacentes(grafo, vertice) != 0) {
+        desligarVizinhos(grafo, vertice);
+        retirarDaLista(grafo, vertice);
+        grafo->linhas = linhas;
+        grafo->colunas = colunas;
+        return -5;
     }
-    return -1; // no encontrado
+    return 0;
+}
+
+/**
+ * @brief Remove um vrtice pelo seu ID, atualizando apenas as listas de adjacncia dos vizinhos.
+ *
+ * Para cada aresta do vrtice, remove a aresta de volta na lista do vizinho, em vez de
+ * percorrer todos os vrtices como `removerVerticePorId`. O custo depende apenas do
+ * nmero de vizinhos (no mximo 8 para as arestas de adjacncia).
+ *
+ * @param grafo Apontador para o grafo.
+ * @param id ID do vrtice a remover.
+ * @return 0 em caso de sucesso, -1 se o vrtice no for encontrado ou grafo invlido.
+ *
+ * @note Requer arestas simtricas (ver `desligarVizinhos`).
+ */
+int removerVerticeComArestas(GR* grafo, int id) {
+    if (!grafo) return -1;
+
+    Vertice* atual = consultarId(grafo, id);
+    if (!atual) return -1;
+
+    retirarDaLista(grafo, atual);
+    desligarVizinhos(grafo, atual);
+    devolverAoPool(&grafo->poolVertices, atual);
+    return 0;
 }
@@ -17,22 +17,39 @@
 
  /**
   * @brief Cria um novo vrtice com ID, frequncia e coordenadas fornecidas.
+  * A memria vem do pool de vrtices do grafo.
   *
+  * @param grafo Apontador para o grafo a que o vrtice vai pertencer.
   * @param id Identificador nico do vrtice.
   * @param frequencia Carcter que representa a frequncia da antena.
   * @param x Coordenada x do vrtice no mapa.
   * @param y Coordenada y do vrtice no mapa.
   * @return Apontador para o vrtice criado ou NULL em caso de erro.
   */
-Vertice* criarVertice(int id, char frequencia, int x, int y);
+Vertice* criarVertice(GR* grafo, int id, char frequencia, int x, int y);
+
+/**
+ * @brief Liberta um vrtice criado com `criarVertice` que no chegou a ser adicionado ao grafo.
+ *
+ * @param grafo Apontador para o grafo onde o vrtice foi criado.
+ * @param v Apontador para o vrtice a libertar.
+ */
+void libertarVertice(GR* grafo, Vertice* v);
 
 /**
  * @brief Adiciona um vrtice ao grafo.
- * Atualiza as dimenses do grafo se necessrio.
+ * Atualiza as dimenses do grafo e os ndices de coordenadas e de IDs.
  *
  * @param grafo Apontador para o grafo onde o vrtice ser adicionado.
  * @param vertice Apontador para o vrtice a adicionar.
- * @return 0 se sucesso, -1 em caso de erro.
+ * @return 0 se sucesso, -1 em caso de erro, -2 se faltar memria,
+ *         -3 se j existir um vrtice nas mesmas coordenadas, -4 se o ID j existir,
+ *         -6 se o ID for demasiado grande para o nmero de vrtices.
+ *
+ * @note O ndice de IDs  uma tabela de acesso direto com 8 bytes (64 bits) por posio
+ *       at ao maior ID. Para que um nico ID alto no a faa crescer para gigabytes,
+ *       IDs a partir de 4096 s so aceites se no passarem de 64 vezes o nmero de
+ *       vrtices.
  */
 int adicionarVertice(GR* grafo, Vertice* vertice);
 
@@ -88,4 +105,25 @@ Vertice* procurarVerticePorId(GR* grafo, int id);
  */
 int removerVerticePorId(GR* grafo, int id);
 
+/**
+ * @brief Adiciona um vrtice e liga-o aos vizinhos adjacentes com a mesma frequncia.
+ * S consulta as 8 posies vizinhas, sem percorrer o grafo.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param vertice Apontador para o vrtice a adicionar.
+ * @return 0 se sucesso, os cdigos de erro de `adicionarVertice`, ou -5 se faltar memria
+ *         para as arestas (o vrtice no  adicionado).
+ */
+int adicionarVerticeComArestas(GR* grafo, Vertice* vertice);
+
+/**
+ * @brief Remove um vrtice pelo seu ID, atualizando s as listas de adjacncia dos vizinhos.
+ * Requer arestas simtricas, como as criadas pelas funes de arestas adjacentes.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param id ID do vrtice a remover.
+ * @return 0 se removido com sucesso, -1 se erro ou no encontrado.
+ */
+int removerVerticeComArestas(GR* grafo, int id);
+
 #endif
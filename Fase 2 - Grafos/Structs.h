@@ -14,6 +14,9 @@
 #ifndef STRUCTS_H
 #define STRUCTS_H
 
+#include <stddef.h>
+#include <stdio.h>
+
  /**
   * @struct Aresta
   * @brief Representa uma ligao (aresta) entre vrtices no grafo.
@@ -37,42 +40,389 @@ typedef struct Aresta {
  *
  * Cada vrtice tem um ID nico, uma frequncia (carcter), coordenadas (x,y),
  * um indicador se foi visitado em procuras, uma lista de arestas adjacentes e
- * um apontador para o prximo vrtice na lista do grafo.
+ * apontadores para o prximo e o anterior vrtice na lista do grafo.
  *
  * @param id Identificador nico do vrtice.
  * @param frequencia Frequncia da antena representada por um carcter.
  * @param x Coordenada x no mapa.
  * @param y Coordenada y no mapa.
  * @param visitado Flag para marcar se o vrtice foi visitado em procuras.
+ * @param indice ndice denso do vrtice no grafo (0 .. numVertices-1).
  * @param adj Lista ligada de arestas (vizinhos).
  * @param next Prximo vrtice na lista do grafo.
+ * @param prev Vrtice anterior na lista do grafo.
  */
 typedef struct Vertice {
     int id;               /**< ID do vrtice */
     char frequencia;      /**< Frequncia da antena */
     int x, y;             /**< Coordenadas no mapa */
     int visitado;         /**< Flag para procuras */
+    int indice;           /**< ndice denso no grafo (-1 se fora do grafo) */
     Aresta* adj;          /**< Lista ligada de arestas adjacentes */
     struct Vertice* next; /**< Prximo vrtice na lista do grafo */
+    struct Vertice* prev; /**< Vrtice anterior na lista do grafo */
 } Vertice;
 
+/**
+ * @struct EntradaCoordenada
+ * @brief Entrada da tabela de disperso que indexa os vrtices pelas suas coordenadas.
+ *
+ * A tabela usa endereamento aberto com sondagem linear. Uma entrada est livre
+ * quando o apontador `vertice`  NULL.
+ *
+ * @param chave Coordenadas (x, y) empacotadas num nico inteiro de 64 bits.
+ * @param vertice Vrtice que ocupa essa posio do mapa.
+ */
+typedef struct EntradaCoordenada {
+    long long chave;           /**< Coordenadas (x,y) empacotadas */
+    Vertice* vertice;          /**< Vrtice nessa posio (NULL se livre) */
+} EntradaCoordenada;
+
+/**
+ * @struct BlocoPool
+ * @brief Cabealho de um bloco de memria de um pool; os elementos seguem-se ao cabealho.
+ *
+ * @param next Prximo bloco do pool.
+ * @param capacidade Nmero de elementos do bloco.
+ */
+typedef struct BlocoPool {
+    struct BlocoPool* next;  /**< Prximo bloco do pool */
+    size_t capacidade;       /**< Nmero de elementos do bloco */
+} BlocoPool;
+
+/**
+ * @struct Pool
+ * @brief Alocador de elementos de tamanho fixo (vrtices ou arestas) do grafo.
+ *
+ * Os elementos so servidos sequencialmente a partir de blocos grandes, e os elementos
+ * devolvidos ficam numa lista de livres para serem reutilizados.
+ *
+ * @param tamanhoElemento Tamanho de cada elemento, em bytes.
+ * @param proximoBloco Nmero de elementos do prximo bloco a alocar.
+ * @param blocos Lista de blocos alocados.
+ * @param posicao Prximo elemento por usar no bloco atual.
+ * @param fim Fim do bloco atual.
+ * @param livres Lista de elementos devolvidos.
+ */
+typedef struct Pool {
+    size_t tamanhoElemento;  /**< Tamanho de cada elemento */
+    size_t proximoBloco;     /**< Elementos do prximo bloco */
+    BlocoPool* blocos;       /**< Blocos alocados */
+    char* posicao;           /**< Prximo elemento livre do bloco atual */
+    char* fim;               /**< Fim do bloco atual */
+    void* livres;            /**< Elementos devolvidos para reutilizar */
+} Pool;
+
+/**
+ * @struct Componentes
+ * @brief Componentes ligadas do grafo, numa estrutura union-find indexada pelo ndice denso.
+ *
+ * Cada vrtice aponta para um pai na mesma componente; a raiz representa a componente
+ * e guarda o seu tamanho. Inseres de vrtices e de arestas atualizam a estrutura na
+ * hora; remoes marcam-na como invlida e ela  reconstruda na consulta seguinte.
+ *
+ * @param pai Pai de cada vrtice (a raiz  pai de si prpria).
+ * @param tamanho Nmero de vrtices da componente (vlido s nas razes).
+ * @param capacidade Nmero de posies dos vetores.
+ * @param numComponentes Nmero de componentes.
+ * @param valida 1 se a estrutura corresponde ao grafo, 0 se tem de ser reconstruda.
+ */
+typedef struct Componentes {
+    int* pai;             /**< Pai de cada ndice denso */
+    int* tamanho;         /**< Tamanho da componente, nas razes */
+    int capacidade;       /**< Nmero de posies dos vetores */
+    int numComponentes;   /**< Nmero de componentes */
+    int valida;           /**< 0 se tem de ser reconstruda */
+} Componentes;
+
 /**
  * @struct GR
  * @brief Representa o grafo, contendo a lista de vrtices e dimenses do mapa.
  *
  * O grafo armazena a lista ligada de vrtices, o nmero total de vrtices,
- * e as dimenses (linhas e colunas) do mapa de antenas.
+ * as dimenses (linhas e colunas) do mapa de antenas e dois ndices (por coordenadas
+ * e por ID) que permitem encontrar um vrtice em tempo constante. Os vrtices e as
+ * arestas so alocados a partir de pools prprios do grafo.
  *
  * @param vertices Apontador para a lista ligada de vrtices.
+ * @param ultimo Apontador para o ltimo vrtice da lista.
  * @param numVertices Nmero total de vrtices no grafo.
  * @param linhas Nmero de linhas do mapa.
  * @param colunas Nmero mximo de colunas do mapa.
+ * @param indiceCoord Tabela de disperso das coordenadas dos vrtices.
+ * @param capacidadeCoord Nmero de entradas da tabela de coordenadas.
+ * @param indiceId Tabela de acesso direto ID -> vrtice.
+ * @param capacidadeId Nmero de posies da tabela de IDs.
+ * @param porIndice Tabela ndice denso -> vrtice.
+ * @param capacidadeDenso Nmero de posies da tabela de ndices densos.
+ * @param poolVertices Alocador dos vrtices do grafo.
+ * @param poolArestas Alocador das arestas do grafo.
+ * @param componentes Componentes ligadas do grafo.
+ * @param versao Contador de alteraes aos vrtices e s arestas.
  */
 typedef struct GR {
     Vertice* vertices;  /**< Lista ligada de vrtices */
+    Vertice* ultimo;    /**< ltimo vrtice da lista */
     int numVertices;    /**< Nmero total de vrtices */
     int linhas;         /**< Nmero de linhas do mapa */
     int colunas;        /**< Nmero mximo de colunas do mapa */
+    EntradaCoordenada* indiceCoord; /**< Tabela de disperso (x,y) -> vrtice */
+    int capacidadeCoord;            /**< Nmero de entradas da tabela (potncia de 2) */
+    Vertice** indiceId;             /**< Tabela de acesso direto ID -> vrtice */
+    int capacidadeId;               /**< Nmero de posies da tabela de IDs */
+    Vertice** porIndice;            /**< Tabela ndice denso -> vrtice */
+    int capacidadeDenso;            /**< Nmero de posies da tabela de ndices densos */
+    Pool poolVertices;              /**< Alocador dos vrtices */
+    Pool poolArestas;               /**< Alocador das arestas */
+    Componentes componentes;        /**< Componentes ligadas (union-find) */
+    unsigned long versao;           /**< Incrementada sempre que um vrtice ou uma aresta muda */
 } GR;
 
+/**
+ * @struct FicheiroMapeado
+ * @brief Contedo de um ficheiro disponvel em memria, mapeado ou lido de uma s vez.
+ *
+ * @param dados Incio do contedo do ficheiro (s de leitura).
+ * @param tamanho Tamanho do contedo, em bytes.
+ * @param mapeado 1 se o contedo foi mapeado em memria, 0 se foi lido para um buffer.
+ */
+typedef struct FicheiroMapeado {
+    const char* dados;    /**< Contedo do ficheiro */
+    size_t tamanho;       /**< Tamanho em bytes */
+    int mapeado;          /**< 1 se mapeado, 0 se lido para memria */
+} FicheiroMapeado;
+
+/**
+ * @struct VerticeCSR
+ * @brief Dados de um vrtice no grafo compacto (CSR).
+ *
+ * @param id Identificador do vrtice no grafo original.
+ * @param x Coordenada x no mapa.
+ * @param y Coordenada y no mapa.
+ * @param frequencia Frequncia da antena.
+ */
+typedef struct VerticeCSR {
+    int id;               /**< ID do vrtice */
+    int x, y;             /**< Coordenadas no mapa */
+    char frequencia;      /**< Frequncia da antena */
+} VerticeCSR;
+
+/**
+ * @struct GrafoCSR
+ * @brief Cpia imutvel e compacta de um grafo no formato CSR (Compressed Sparse Row).
+ *
+ * Os vrtices so numerados de 0 a numVertices-1 (ndice denso). As arestas que saem
+ * do vrtice i ocupam as posies offsets[i] .. offsets[i+1]-1 dos vetores `destinos`
+ * e `pesos`, pela mesma ordem da lista de adjacncia original. Todos os vetores vivem
+ * num nico bloco de memria contguo, que pode ter sido alocado (`congelarGrafo`) ou
+ * mapeado diretamente de um ficheiro binrio (`carregarGrafoCSRBinario`), numa cpia
+ * privada que pode ser escrita sem alterar o ficheiro.
+ *
+ * @param numVertices Nmero de vrtices.
+ * @param numArestas Nmero de arestas dirigidas.
+ * @param linhas Nmero de linhas do mapa.
+ * @param colunas Nmero mximo de colunas do mapa.
+ * @param maxId Maior ID de vrtice existente.
+ * @param vertices Dados de cada vrtice, por ndice denso.
+ * @param offsets Incio das arestas de cada vrtice (numVertices + 1 posies).
+ * @param destinos ndice denso do destino de cada aresta.
+ * @param pesos Peso de cada aresta.
+ * @param indicePorId ndice denso de cada ID (-1 se o ID no existir).
+ * @param bloco Bloco de memria que contm todos os vetores.
+ * @param ficheiro Ficheiro mapeado que contm o bloco, se o grafo foi carregado de um ficheiro binrio.
+ */
+typedef struct GrafoCSR {
+    int numVertices;      /**< Nmero de vrtices */
+    int numArestas;       /**< Nmero de arestas dirigidas */
+    int linhas;           /**< Nmero de linhas do mapa */
+    int colunas;          /**< Nmero mximo de colunas do mapa */
+    int maxId;            /**< Maior ID de vrtice */
+    VerticeCSR* vertices; /**< Vrtices por ndice denso */
+    int* offsets;         /**< Incio das arestas de cada vrtice */
+    int* destinos;        /**< Destino de cada aresta (ndice denso) */
+    float* pesos;         /**< Peso de cada aresta */
+    int* indicePorId;     /**< ID -> ndice denso */
+    void* bloco;          /**< Memria que contm todos os vetores */
+    FicheiroMapeado ficheiro; /**< Origem do bloco, se mapeado (dados == NULL se alocado) */
+} GrafoCSR;
+
+/**
+ * @struct OpcoesLargura
+ * @brief Afinao da procura em largura paralela (0 = valor por omisso).
+ *
+ * @param trabalhoMinimo Arestas (ou vrtices) por thread a partir das quais um nvel  repartido.
+ * @param direcao DIRECAO_AUTOMATICA, DIRECAO_CIMA_PARA_BAIXO ou DIRECAO_BAIXO_PARA_CIMA.
+ */
+typedef struct OpcoesLargura {
+    long long trabalhoMinimo; /**< Trabalho mnimo por thread em cada nvel */
+    int direcao;              /**< Sentido dos nveis (0 = escolhido em cada nvel) */
+} OpcoesLargura;
+
+/**
+ * @struct LimitesCaminhos
+ * @brief Limites de uma enumerao de caminhos (0 = sem limite).
+ *
+ * @param comprimentoMaximo Nmero mximo de vrtices de cada caminho.
+ * @param maxCaminhos Nmero mximo de caminhos a entregar.
+ */
+typedef struct LimitesCaminhos {
+    int comprimentoMaximo;   /**< Vrtices por caminho (0 = sem limite) */
+    int maxCaminhos;         /**< Caminhos a entregar (0 = sem limite) */
+} LimitesCaminhos;
+
+/**
+ * @struct GrelhaFrequencia
+ * @brief Ocupao do mapa pelas antenas de uma frequncia, numa grelha densa.
+ *
+ * Cada clula guarda o ndice denso da antena dessa frequncia na posio, ou -1 se a
+ * posio estiver livre ou tiver outra frequncia. A grelha tem uma moldura de clulas
+ * a -1  volta, pelo que os vizinhos de uma clula ocupada existem sempre.
+ *
+ * @param celulas ndice denso de cada clula (linha a linha), ou -1.
+ * @param largura Nmero de colunas, incluindo a moldura.
+ * @param altura Nmero de linhas, incluindo a moldura.
+ * @param xMin Coordenada x da primeira coluna dentro da moldura.
+ * @param yMin Coordenada y da primeira linha dentro da moldura.
+ * @param frequencia Frequncia das antenas da grelha.
+ * @param grafo Grafo de onde a grelha foi criada.
+ * @param versaoGrafo `grafo->versao` quando a grelha foi criada.
+ */
+typedef struct GrelhaFrequencia {
+    int* celulas;         /**< ndice denso por clula (-1 se livre) */
+    int largura;          /**< Colunas, com a moldura */
+    int altura;           /**< Linhas, com a moldura */
+    int xMin;             /**< x da primeira coluna interior */
+    int yMin;             /**< y da primeira linha interior */
+    char frequencia;      /**< Frequncia das antenas */
+    const GR* grafo;      /**< Grafo da grelha */
+    unsigned long versaoGrafo; /**< Verso do grafo a que os ndices correspondem */
+} GrelhaFrequencia;
+
+/**
+ * @struct Marcos
+ * @brief Pr-processamento ALT: distncias de todos os vrtices a alguns vrtices de
+ * referncia (marcos), usadas como heurstica de A* pela desigualdade triangular.
+ *
+ * As distncias de cada vrtice esto seguidas em memria, pelo que a heurstica de um
+ * vrtice l uma nica linha de `numMarcos` valores.
+ *
+ * @param numMarcos Nmero de marcos (colunas de `distancias`).
+ * @param numVertices Nmero de vrtices do grafo quando os marcos foram calculados.
+ * @param indices ndice denso de cada marco (-1 se no foi escolhido).
+ * @param distancias Distncia do vrtice i ao marco k em [i * numMarcos + k] (-1 se inalcanvel).
+ * @param grafo Grafo pr-processado.
+ * @param versaoGrafo `grafo->versao` quando as distncias foram calculadas ou carregadas.
+ */
+typedef struct Marcos {
+    int numMarcos;        /**< Nmero de marcos */
+    int numVertices;      /**< Vrtices do grafo pr-processado */
+    int* indices;         /**< ndice denso de cada marco */
+    double* distancias;   /**< Distncias, uma linha por vrtice */
+    const GR* grafo;      /**< Grafo pr-processado */
+    unsigned long versaoGrafo; /**< Verso do grafo a que as distncias correspondem */
+} Marcos;
+
+/**
+ * @struct EntradaHeap
+ * @brief Posio de um `HeapIndexado`: a chave fica junto do ndice, para que as
+ * comparaes no tenham de ir buscar dados a outros vetores.
+ *
+ * @param chave Prioridade (a menor sai primeiro).
+ * @param desempate Critrio de desempate entre chaves iguais (o menor sai primeiro).
+ * @param indice ndice denso do vrtice.
+ */
+typedef struct EntradaHeap {
+    double chave;         /**< Prioridade */
+    double desempate;     /**< Desempate entre chaves iguais */
+    int indice;           /**< ndice denso do vrtice */
+} EntradaHeap;
+
+/**
+ * @struct HeapIndexado
+ * @brief Heap 4-rio de mnimos, com a posio de cada vrtice para diminuir a sua chave.
+ *
+ * @param entradas Entradas do heap (os filhos de i esto em 4i+1 .. 4i+4).
+ * @param posicao Posio de cada ndice denso em `entradas` (-1 depois de sair do heap).
+ * @param tamanho Nmero de entradas no heap.
+ * @param capacidade Nmero de posies dos vetores.
+ */
+typedef struct HeapIndexado {
+    EntradaHeap* entradas; /**< Entradas do heap */
+    int* posicao;          /**< ndice denso -> posio em `entradas` */
+    int tamanho;           /**< Nmero de entradas */
+    int capacidade;        /**< Nmero de posies dos vetores */
+} HeapIndexado;
+
+/**
+ * @struct ContextoProcura
+ * @brief Estado de uma procura guardado fora dos vrtices.
+ *
+ * As marcas de visita so indexadas pelo ndice denso do vrtice (`Vertice::indice`) e
+ * guardam a poca em que o vrtice foi visitado: comear uma nova procura  s
+ * incrementar `epoca`. Cada thread usa o seu contexto, pelo que vrias procuras podem
+ * correr ao mesmo tempo sobre o mesmo grafo, desde que este no seja alterado.
+ *
+ * @param marcas poca da ltima visita de cada vrtice (0 = nunca visitado).
+ * @param epoca poca da procura atual.
+ * @param epocaLargura poca da ltima procura em largura (0 = nenhuma): `distancias` s
+ *         vlido enquanto for igual a `epoca`.
+ * @param epocaCaminho poca da ltima procura de caminho mais curto (0 = nenhuma): `custos`
+ *        s  vlido enquanto for igual a `epoca`.
+ * @param capacidade Nmero de posies dos vetores do contexto.
+ * @param fila Vetor de trabalho para a fila ou a pilha das procuras.
+ * @param cursores Prxima aresta a explorar de cada vrtice da pilha da procura em profundidade.
+ * @param caminho Vetor de trabalho para o caminho corrente.
+ * @param distancias Nmero de arestas desde a origem da ltima procura em largura.
+ * @param pais ndice denso do antecessor de cada vrtice na ltima procura em largura ou de
+ *        caminho mais curto (-1 na origem), vlido se uma das duas pocas acima for a atual.
+ * @param custos Custo (soma dos pesos) desde a origem, na ltima procura de caminho mais curto.
+ * @param heap Fila de prioridade das procuras de caminho mais curto.
+ * @param expandidos Nmero de vrtices expandidos na ltima procura de caminho mais curto.
+ */
+typedef struct ContextoProcura {
+    unsigned int* marcas; /**< poca da visita de cada ndice denso */
+    unsigned int epoca;   /**< poca da procura atual */
+    unsigned int epocaLargura; /**< poca da ltima procura em largura */
+    unsigned int epocaCaminho; /**< poca da ltima procura de caminho mais curto */
+    int capacidade;       /**< Nmero de posies dos vetores */
+    Vertice** fila;       /**< Fila (ou pilha) de vrtices */
+    Aresta** cursores;    /**< Cursor de adjacncia de cada posio da pilha */
+    Vertice** caminho;    /**< Caminho corrente */
+    int* distancias;      /**< Distncia  origem (procura em largura) */
+    int* pais;            /**< Antecessor de cada vrtice */
+    double* custos;       /**< Custo desde a origem (caminho mais curto) */
+    HeapIndexado heap;    /**< Fila de prioridade (caminho mais curto) */
+    int expandidos;       /**< Vrtices expandidos na ltima procura de caminho */
+} ContextoProcura;
+
+/**
+ * @struct SaidaBuffer
+ * @brief Sada de texto com um buffer prprio, escrito no ficheiro s quando enche.
+ *
+ * @param ficheiro Ficheiro de destino (por exemplo, stdout).
+ * @param dados Buffer com o texto ainda por escrever.
+ * @param usado Nmero de bytes ocupados no buffer.
+ * @param capacidade Tamanho do buffer.
+ */
+typedef struct SaidaBuffer {
+    FILE* ficheiro;       /**< Ficheiro de destino */
+    char* dados;          /**< Texto por escrever */
+    size_t usado;         /**< Bytes ocupados */
+    size_t capacidade;    /**< Tamanho do buffer */
+} SaidaBuffer;
+
+/**
+ * @struct ListaIds
+ * @brief Vetor de IDs preenchido por uma procura, com capacidade fixa dada pelo chamador.
+ *
+ * @param ids Vetor de destino.
+ * @param capacidade Nmero de posies de `ids`.
+ * @param tamanho Nmero de IDs j escritos.
+ */
+typedef struct ListaIds {
+    int* ids;             /**< Vetor de destino */
+    int capacidade;       /**< Nmero de posies */
+    int tamanho;          /**< IDs escritos */
+} ListaIds;
+
 #endif // STRUCTS_H
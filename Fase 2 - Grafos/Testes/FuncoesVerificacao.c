@@ -0,0 +1,344 @@
+/**
+ * @file FuncoesVerificacao.c
+ * @brief Implementao das verificaes das procuras otimizadas.
+ *
+ * @details
+ * As referncias so as procuras sequenciais mais simples do projeto (`procurarEmLargura`
+ * e `caminhoDijkstra`), que no dependem das estruturas que se verificam. Os resultados
+ * comparados so deterministas: ordens de visita, distncias, custos e contagens, nunca
+ * tempos nem antecessores que dependam da ordem das threads.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "Structs.h"
+#include "FuncoesVerificacao.h"
+#include "FuncoesBusca.h"
+#include "FuncoesBuscaParalela.h"
+#include "FuncoesCSR.h"
+#include "FuncoesComponentes.h"
+#include "FuncoesCaminhoMinimo.h"
+#include "FuncoesGrelha.h"
+#include "FuncoesMarcos.h"
+#include "FuncoesEnumeracao.h"
+#include "FuncoesContexto.h"
+
+/**
+ * @brief Imprime o resultado de uma verificao.
+ *
+ * @param descricao Descrio da verificao.
+ * @param resultado 0 (coincide), 1 (difere) ou negativo (erro).
+ * @return O prprio `resultado`.
+ */
+int imprimirVerificacao(const char* descricao, int resultado) {
+    const char* estado = resultado == 0 ? "OK" : (resultado > 0 ? "FALHOU" : "ERRO");
+    printf("%-50s %s\n", descricao, estado);
+    return resultado;
+}
+
+#define TOLERANCIA_CUSTO 1e-6   // os custos somam pesos float por ordens diferentes
+
+/**
+ * @brief Indica se dois custos de caminho so iguais (-1 = sem caminho).
+ */
+static int custosIguais(double a, double b) {
+    return fabs(a - b) <= TOLERANCIA_CUSTO;
+}
+
+/**
+ * @brief Visitante que s conta os vrtices.
+ */
+static int contarVisitante(Vertice* v, void* dados) {
+    (void)v;
+    (*(int*)dados)++;
+    return 0;
+}
+
+/**
+ * @brief Compara os visitantes com `procurarEmLargura`.
+ *
+ * @param grafo Apontador para o grafo.
+ * @return 0 se coincidem, 1 se diferem, -1 se faltar memria.
+ */
+int verificarVisitantes(GR* grafo) {
+    if (!grafo) return -1;
+    int n = grafo->numVertices;
+    ContextoProcura* ctx = criarContextoProcura(grafo);
+    int* referencia = malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    int* ids = malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    if (!ctx || !referencia || !ids) {
+        libertarContextoProcura(ctx);
+        free(referencia);
+        free(ids);
+        return -1;
+    }
+
+    int resultado = 0;
+    for (int i = 0; i < n && resultado == 0; i++) {
+        Vertice* origem = grafo->porIndice[i];
+        int alcancados = procurarEmLargura(ctx, grafo, origem);
+        if (alcancados < 0) {
+            resultado = -1;
+            break;
+        }
+        for (int k = 0; k < alcancados; k++) {
+            referencia[k] = ctx->fila[k]->id;
+        }
+
+        ListaIds lista = { ids, n, 0 };
+        if (bftVisitante(ctx, grafo, origem, guardarIdVisitante, &lista) != alcancados ||
+            lista.tamanho != alcancados) {
+            resultado = 1;
+        }
+        for (int k = 0; k < lista.tamanho && resultado == 0; k++) {
+            if (ids[k] != referencia[k]) resultado = 1;
+        }
+
+        int contados = 0;
+        if (dftVisitante(ctx, grafo, origem, contarVisitante, &contados) != alcancados ||
+            contados != alcancados) {
+            resultado = 1;
+        }
+
+        ListaIds primeiro = { ids, 1, 0 };  // cheia ao primeiro vrtice: a procura pra
+        if (bftVisitante(ctx, grafo, origem, guardarIdVisitante, &primeiro) != 1 ||
+            ids[0] != origem->id) {
+            resultado = 1;
+        }
+    }
+
+    libertarContextoProcura(ctx);
+    free(referencia);
+    free(ids);
+    return resultado;
+}
+
+/**
+ * @brief Compara a procura em largura paralela sobre o CSR com `procurarEmLargura`.
+ *
+ * A procura paralela corre com uma aresta mnima por thread, para que os nveis do grafo de
+ * demonstrao sejam repartidos pelas threads, e em cada um dos sentidos: no automtico, um
+ * grafo pequeno passa logo a baixo para cima e o sentido de cima para baixo no seria testado.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param numThreads Nmero de threads da procura paralela.
+ * @return 0 se coincidem, 1 se diferem, -1 se faltar memria.
+ */
+int verificarLarguraParalela(GR* grafo, int numThreads) {
+    if (!grafo) return -1;
+    int n = grafo->numVertices;
+    GrafoCSR* csr = congelarGrafo(grafo);
+    ContextoProcura* ctx = criarContextoProcura(grafo);
+    int* distancias = malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    int* pais = malloc((size_t)(n > 0 ? n : 1) * sizeof(int));
+    int resultado = csr && ctx && distancias && pais ? 0 : -1;
+
+    // os ndices do CSR seguem a lista do grafo, no os ndices densos: converte-se pelo ID
+    const int direcoes[3] = { DIRECAO_AUTOMATICA, DIRECAO_CIMA_PARA_BAIXO, DIRECAO_BAIXO_PARA_CIMA };
+    for (int d = 0; d < 3 && resultado == 0; d++) {
+        OpcoesLargura opcoes = { 1, direcoes[d] };   // um nvel com duas arestas j usa duas threads
+        for (int i = 0; i < n && resultado == 0; i++) {
+            Vertice* origem = grafo->porIndice[i];
+            int alcancados = procurarEmLargura(ctx, grafo, origem);
+            int paralelos = procurarEmLarguraCSRParalelaOpcoes(csr, indiceCSRPorId(csr, origem->id),
+                distancias, pais, numThreads, &opcoes);
+            if (alcancados < 0 || paralelos < 0) {
+                resultado = -1;
+                break;
+            }
+            if (paralelos != alcancados) resultado = 1;
+
+            for (int k = 0; k < n && resultado == 0; k++) {
+                const Vertice* v = grafo->porIndice[k];
+                int c = indiceCSRPorId(csr, v->id);
+                if (distancias[c] != distanciaProcura(ctx, v)) {
+                    resultado = 1;
+                }
+                else if (distancias[c] > 0 && (pais[c] < 0 || distancias[pais[c]] != distancias[c] - 1)) {
+                    resultado = 1;
+                }
+            }
+        }
+    }
+
+    libertarGrafoCSR(csr);
+    libertarContextoProcura(ctx);
+    free(distancias);
+    free(pais);
+    return resultado;
+}
+
+/**
+ * @brief Compara as componentes com as procuras em largura de cada vrtice.
+ *
+ * @param grafo Apontador para o grafo.
+ * @return 0 se coincidem, 1 se diferem, -1 se faltar memria.
+ */
+int verificarComponentes(GR* grafo) {
+    if (!grafo) return -1;
+    int n = grafo->numVertices;
+    ContextoProcura* ctx = criarContextoProcura(grafo);
+    if (!ctx) return -1;
+
+    int resultado = 0;
+    for (int i = 0; i < n && resultado == 0; i++) {
+        Vertice* origem = grafo->porIndice[i];
+        int alcancados = procurarEmLargura(ctx, grafo, origem);
+        int tamanho = tamanhoComponente(grafo, origem);
+        if (alcancados < 0 || tamanho < 0) {
+            resultado = -1;
+            break;
+        }
+        if (tamanho != alcancados) resultado = 1;
+
+        for (int k = 0; k < n && resultado == 0; k++) {
+            const Vertice* v = grafo->porIndice[k];
+            int mesmo = mesmoComponente(grafo, origem, v);
+            if (mesmo < 0) resultado = -1;
+            else if (mesmo != (distanciaProcura(ctx, v) >= 0)) resultado = 1;
+        }
+    }
+
+    libertarContextoProcura(ctx);
+    return resultado;
+}
+
+/**
+ * @brief Compara Jump Point Search com Dijkstra em todos os pares da mesma frequncia.
+ *
+ * @param grafo Apontador para o grafo.
+ * @return 0 se coincidem, 1 se diferem, -1 se faltar memria.
+ */
+int verificarJPS(GR* grafo) {
+    if (!grafo) return -1;
+    int n = grafo->numVertices;
+    ContextoProcura* ctx = criarContextoProcura(grafo);
+    if (!ctx) return -1;
+    GrelhaFrequencia* grelhas[256] = { NULL };  // uma por frequncia, criada quando  precisa
+
+    int resultado = 0;
+    for (int i = 0; i < n && resultado == 0; i++) {
+        Vertice* origem = grafo->porIndice[i];
+        unsigned char f = (unsigned char)origem->frequencia;
+        if (!grelhas[f]) grelhas[f] = criarGrelhaFrequencia(grafo, origem->frequencia);
+        if (!grelhas[f]) {
+            resultado = -1;
+            break;
+        }
+
+        for (int k = 0; k < n && resultado == 0; k++) {
+            Vertice* destino = grafo->porIndice[k];
+            if (destino->frequencia != origem->frequencia) continue;
+            double custoJPS, custoDijkstra;
+            int r = caminhoJPS(ctx, grafo, grelhas[f], origem, destino, &custoJPS);
+            int d = caminhoDijkstra(ctx, grafo, origem, destino, &custoDijkstra);
+            if (r < 0 || d < 0) resultado = -1;
+            else if ((r == 0) != (d == 0) || !custosIguais(custoJPS, custoDijkstra)) resultado = 1;
+        }
+    }
+
+    for (int f = 0; f < 256; f++) {
+        libertarGrelhaFrequencia(grelhas[f]);
+    }
+    libertarContextoProcura(ctx);
+    return resultado;
+}
+
+/**
+ * @brief Compara A* com a heurstica ALT com Dijkstra em todos os pares de vrtices.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param numMarcos Nmero de marcos.
+ * @return 0 se coincidem, 1 se diferem, -1 se faltar memria.
+ */
+int verificarALT(GR* grafo, int numMarcos) {
+    if (!grafo) return -1;
+    int n = grafo->numVertices;
+    Marcos* marcos = criarMarcos(grafo, numMarcos);
+    ContextoProcura* ctx = criarContextoProcura(grafo);
+    int resultado = marcos && ctx ? 0 : -1;
+
+    for (int i = 0; i < n && resultado == 0; i++) {
+        Vertice* origem = grafo->porIndice[i];
+        for (int k = 0; k < n && resultado == 0; k++) {
+            Vertice* destino = grafo->porIndice[k];
+            double custoALT, custoDijkstra;
+            int r = caminhoALT(ctx, grafo, marcos, origem, destino, &custoALT);
+            int d = caminhoDijkstra(ctx, grafo, origem, destino, &custoDijkstra);
+            if (r < 0 || d < 0) resultado = -1;
+            else if ((r == 0) != (d == 0) || !custosIguais(custoALT, custoDijkstra)) resultado = 1;
+        }
+    }
+
+    libertarMarcos(marcos);
+    libertarContextoProcura(ctx);
+    return resultado;
+}
+
+/**
+ * @brief Resumo de um conjunto de caminhos que no depende da ordem em que so entregues.
+ */
+typedef struct ResumoCaminhos {
+    int comprimentoMaximo;   /**< Caminhos mais longos no contam (0 = sem limite) */
+    long numCaminhos;        /**< Caminhos contados */
+    long somaComprimentos;   /**< Soma do nmero de vrtices dos caminhos contados */
+} ResumoCaminhos;
+
+/**
+ * @brief Visitante que acrescenta um caminho ao resumo.
+ */
+static int resumirCaminho(Vertice* caminho[], int tamanho, void* dados) {
+    (void)caminho;
+    ResumoCaminhos* r = dados;
+    if (r->comprimentoMaximo > 0 && tamanho > r->comprimentoMaximo) return 0;
+    r->numCaminhos++;
+    r->somaComprimentos += tamanho;
+    return 0;
+}
+
+/**
+ * @brief Compara a enumerao podada (sequencial e paralela) com a procura recursiva.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @param comprimentoMaximo Comprimento mximo a testar.
+ * @param numThreads Nmero de threads da enumerao paralela.
+ * @return 0 se coincidem, 1 se diferem, -1 se parmetros invlidos ou faltar memria.
+ */
+int verificarEnumeracao(GR* grafo, Vertice* origem, Vertice* destino, int comprimentoMaximo, int numThreads) {
+    if (!grafo || !origem || !destino) return -1;
+    ContextoProcura* ctx = criarContextoProcura(grafo);
+    if (!ctx) return -1;
+
+    int comprimentos[2] = { 0, comprimentoMaximo };
+    int threads[2] = { 1, numThreads };
+    int resultado = 0;
+    for (int c = 0; c < 2 && resultado == 0; c++) {
+        // a procura recursiva encontra todos os caminhos; os longos so descartados no resumo
+        ResumoCaminhos referencia = { comprimentos[c], 0, 0 };
+        if (encontrarTodosCaminhosVisitante(ctx, grafo, origem, destino, resumirCaminho, &referencia) < 0) {
+            resultado = -1;
+            break;
+        }
+
+        for (int t = 0; t < 2 && resultado == 0; t++) {
+            ResumoCaminhos resumo = { 0, 0, 0 };
+            LimitesCaminhos limites = { comprimentos[c], 0 };
+            int entregues = enumerarCaminhos(grafo, origem, destino, &limites, resumirCaminho, &resumo, threads[t]);
+            if (entregues < 0) resultado = -1;
+            else if (entregues != resumo.numCaminhos || resumo.numCaminhos != referencia.numCaminhos ||
+                resumo.somaComprimentos != referencia.somaComprimentos) {
+                resultado = 1;
+            }
+        }
+    }
+
+    libertarContextoProcura(ctx);
+    return resultado;
+}
@@ -0,0 +1,95 @@
+#ifndef FUNCOESVERIFICACAO_H
+#define FUNCOESVERIFICACAO_H
+
+/**
+ * @file FuncoesVerificacao.h
+ * @brief Declarao das verificaes que comparam as procuras otimizadas com as de referncia.
+ *
+ * Cada verificao corre a verso otimizada e a verso simples sobre o mesmo grafo e
+ * compara os resultados. Todas as origens do grafo so testadas (algumas verificaes
+ * fazem O(V) procuras), pelo que se destinam a mapas pequenos e s fazem parte do
+ * programa de testes (Testes/main.c), nunca do programa principal.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include "Structs.h"
+
+ /**
+  * @brief Imprime o resultado de uma verificao numa linha ("OK", "FALHOU" ou "ERRO").
+  *
+  * @param descricao Descrio da verificao.
+  * @param resultado Valor devolvido pela verificao.
+  * @return O prprio `resultado`, para que quem chama possa contar as falhas.
+  */
+int imprimirVerificacao(const char* descricao, int resultado);
+
+/**
+ * @brief Compara `bftVisitante` e `dftVisitante` com `procurarEmLargura`, a partir de cada vrtice.
+ *
+ * O visitante da procura em largura tem de receber os vrtices pela ordem de `ctx->fila`, e
+ * o da procura em profundidade os mesmos vrtices; um visitante que pede para parar ao
+ * primeiro vrtice tem de receber s esse.
+ *
+ * @param grafo Apontador para o grafo.
+ * @return 0 se os resultados coincidem, 1 se diferem, -1 se faltar memria.
+ */
+int verificarVisitantes(GR* grafo);
+
+/**
+ * @brief Compara `procurarEmLarguraCSRParalela` com `procurarEmLargura`, a partir de cada vrtice.
+ *
+ * As distncias tm de ser iguais; os antecessores, que dependem das threads, s tm de
+ * estar no nvel anterior.
+ *
+ * @param grafo Apontador para o grafo (as arestas devem ser simtricas).
+ * @param numThreads Nmero de threads da procura paralela.
+ * @return 0 se os resultados coincidem, 1 se diferem, -1 se faltar memria.
+ */
+int verificarLarguraParalela(GR* grafo, int numThreads);
+
+/**
+ * @brief Compara as componentes (union-find) com os vrtices alcanados por `procurarEmLargura`.
+ *
+ * @param grafo Apontador para o grafo (as arestas devem ser simtricas).
+ * @return 0 se os resultados coincidem, 1 se diferem, -1 se faltar memria.
+ */
+int verificarComponentes(GR* grafo);
+
+/**
+ * @brief Compara os custos de `caminhoJPS` com os de `caminhoDijkstra`, para cada par de
+ * antenas da mesma frequncia.
+ *
+ * @param grafo Apontador para o grafo (arestas de `criarArestasAdjacentes`).
+ * @return 0 se os resultados coincidem, 1 se diferem, -1 se faltar memria.
+ */
+int verificarJPS(GR* grafo);
+
+/**
+ * @brief Compara os custos de `caminhoALT` com os de `caminhoDijkstra`, para cada par de vrtices.
+ *
+ * @param grafo Apontador para o grafo.
+ * @param numMarcos Nmero de marcos a calcular.
+ * @return 0 se os resultados coincidem, 1 se diferem, -1 se faltar memria.
+ */
+int verificarALT(GR* grafo, int numMarcos);
+
+/**
+ * @brief Compara `enumerarCaminhos` com `encontrarTodosCaminhosVisitante` entre dois vrtices.
+ *
+ * Para cada comprimento mximo (sem limite e `comprimentoMaximo`) e com 1 e `numThreads`
+ * threads, o nmero de caminhos e a soma dos seus comprimentos tm de ser os da procura
+ * recursiva, que no poda; a ordem dos caminhos no  comparada.
+ *
+ * @param grafo Apontador para o grafo (as arestas devem ser simtricas).
+ * @param origem Apontador para o vrtice de partida.
+ * @param destino Apontador para o vrtice de chegada.
+ * @param comprimentoMaximo Comprimento mximo (em vrtices) a testar alm de "sem limite".
+ * @param numThreads Nmero de threads da enumerao paralela.
+ * @return 0 se os resultados coincidem, 1 se diferem, -1 se parmetros invlidos ou faltar memria.
+ */
+int verificarEnumeracao(GR* grafo, Vertice* origem, Vertice* destino, int comprimentoMaximo, int numThreads);
+
+#endif // FUNCOESVERIFICACAO_H
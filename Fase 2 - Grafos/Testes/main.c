@@ -0,0 +1,64 @@
+/**
+ * @file main.c
+ * @brief Programa de testes: compara as procuras otimizadas com as de referncia.
+ *
+ * @details
+ * Constri o mesmo grafo do programa principal (o mapa, mais a antena 17 em (3,3), e as
+ * arestas entre antenas adjacentes da mesma frequncia) e corre as verificaes de
+ * FuncoesVerificacao.h sobre ele. O mapa pode ser indicado como argumento; por omisso 
+ * o do programa principal. Algumas verificaes testam todos os pares de vrtices, pelo
+ * que o mapa deve ser pequeno.
+ *
+ * O programa termina com 0 se todas as verificaes passarem e com 1 caso contrrio.
+ *
+ * @author Duarte "macrogod" Pereira
+ * @date 2025-05-18
+ * @version 1.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <locale.h>
+#include "Structs.h"
+#include "FuncoesGrafo.h"
+#include "FuncoesVertice.h"
+#include "FuncoesAresta.h"
+#include "FuncoesFicheiro.h"
+#include "FuncoesVerificacao.h"
+
+#define MAPA_POR_OMISSAO "../mapa_antenas.txt"   // relativo  pasta Testes
+
+int main(int argc, char* argv[]) {
+    setlocale(LC_ALL, "Portuguese");
+
+    const char* nomeMapa = argc > 1 ? argv[1] : MAPA_POR_OMISSAO;
+    GR* grafo = criarGrafo();
+    if (!grafo || carregarMapaNoGrafo(grafo, nomeMapa) != 0) {
+        printf("No foi possvel carregar o mapa \"%s\".\n", nomeMapa);
+        libertarGrafo(grafo);
+        return 1;
+    }
+
+    // O mesmo grafo do programa principal
+    Vertice* v1 = criarVertice(grafo, 17, '0', 3, 3);
+    adicionarVertice(grafo, v1);
+    criarArestasAdjacentes(grafo);
+
+    Vertice* origem = procurarVerticePorId(grafo, 5);
+    Vertice* destino = procurarVerticePorId(grafo, 15);
+
+    int falhas = 0;
+    printf("=== Verificaes ===\n");
+    falhas += imprimirVerificacao("Visitantes BFS/DFS vs procurarEmLargura", verificarVisitantes(grafo)) != 0;
+    falhas += imprimirVerificacao("BFS paralela (CSR) vs procurarEmLargura", verificarLarguraParalela(grafo, 4)) != 0;
+    falhas += imprimirVerificacao("Componentes (union-find) vs procurarEmLargura", verificarComponentes(grafo)) != 0;
+    falhas += imprimirVerificacao("Jump Point Search vs Dijkstra", verificarJPS(grafo)) != 0;
+    falhas += imprimirVerificacao("A* com marcos (ALT) vs Dijkstra", verificarALT(grafo, 4)) != 0;
+    if (origem && destino) {
+        falhas += imprimirVerificacao("Enumerao de caminhos vs procura recursiva",
+            verificarEnumeracao(grafo, origem, destino, 6, 4)) != 0;
+    }
+
+    libertarGrafo(grafo);
+    return falhas > 0 ? 1 : 0;
+}
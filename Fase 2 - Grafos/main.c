@@ -45,10 +45,10 @@ int main() {
     printf("Nmero de antenas (vrtices) lidos: %d\n\n", grafo->numVertices);
 
     // Cria e adiciona manualmente dois vrtices (antenas) ao grafo
-    Vertice* v1 = criarVertice(17, '0', 3, 3);
+    Vertice* v1 = criarVertice(grafo, 17, '0', 3, 3);
     adicionarVertice(grafo, v1);
 
-    Vertice* v2 = criarVertice(16, 'A', 13, 2);
+    Vertice* v2 = criarVertice(grafo, 16, 'A', 13, 2);
     adicionarVertice(grafo, v2);
 
     // Cria arestas entre antenas adjacentes que tm a mesma frequncia
@@ -104,7 +104,12 @@ int main() {
 
     // Encontra e imprime todos os caminhos possveis entre a antena de origem e a de destino
     printf("=== Todos os caminhos entre antena %d e antena %d ===\n", origem->id, destino->id);
-    encontrarTodosCaminhos(origem, destino, caminho, 0);
+    int omitidos = 0;
+    encontrarTodosCaminhos(origem, destino, caminho, 0, (int)(sizeof(caminho) / sizeof(caminho[0])), &omitidos);
+    if (omitidos > 0) {
+        printf("(%d caminhos com mais de %d antenas no foram impressos)\n", omitidos,
+            (int)(sizeof(caminho) / sizeof(caminho[0])));
+    }
 
     // Liberta toda a memria alocada para o grafo e respetivas estruturas
     libertarGrafo(grafo);